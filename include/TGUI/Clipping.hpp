@@ -36,7 +36,11 @@
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
+    /// @brief Restricts drawing to a rectangle for as long as the object exists
+    ///
+    /// Without batching the view of the render target is changed. When the geometry is being collected in a VertexBatch, the
+    /// rectangle is pushed on the clipping stack of the batch instead, so that clipped widgets can still share draw calls.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API Clipping
     {
     public:
@@ -68,11 +72,19 @@ namespace tgui
         static void setGuiView(const sf::View& view);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns the view that was passed to setGuiView
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const sf::View& getGuiView();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         sf::RenderTarget& m_target;
         sf::View m_oldView;
+        bool m_batched = false;
 
         static sf::View m_originalView;
     };
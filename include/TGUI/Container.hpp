@@ -28,8 +28,12 @@
 
 
 #include <list>
+#include <unordered_map>
+#include <cstdint>
+#include <memory>
 
 #include <TGUI/Widget.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -161,6 +165,68 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a direct child of the container
+        ///
+        /// @param widgetName The name that was given to the widget when it was added to the container
+        ///
+        /// Unlike the get function, widgets inside child containers are not searched.
+        ///
+        /// @return Pointer to the first child widget with the given name, or nullptr when there is no such child
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getDirect(const sf::String& widgetName) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a direct child of the container
+        ///
+        /// @param widgetName The name that was given to the widget when it was added to the container
+        ///
+        /// @return Pointer to the first child widget with the given name, casted to the desired type.
+        ///         A nullptr is returned when there is no such child.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T>
+        typename T::Ptr getDirect(const sf::String& widgetName) const
+        {
+            return std::dynamic_pointer_cast<T>(getDirect(widgetName));
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget inside this container or inside one of its child containers
+        ///
+        /// @param widgetName The name that was given to the widget when it was added to its container
+        ///
+        /// The direct children are searched first, the child containers are only searched when none of the direct children
+        /// has the given name. This is the same as calling the get function.
+        ///
+        /// Every container keeps track of the names of all widgets inside it, so finding out that no widget has the given name
+        /// doesn't require searching through all child containers.
+        ///
+        /// @return Pointer to the widget with the given name, or nullptr when there is no such widget
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getRecursive(const sf::String& widgetName) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget inside this container or inside one of its child containers
+        ///
+        /// @param widgetName The name that was given to the widget when it was added to its container
+        ///
+        /// @return Pointer to the widget with the given name, casted to the desired type.
+        ///         A nullptr is returned when there is no such widget.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T>
+        typename T::Ptr getRecursive(const sf::String& widgetName) const
+        {
+            return std::dynamic_pointer_cast<T>(getRecursive(widgetName));
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes a single widget that was added to the container
         ///
@@ -318,6 +384,66 @@ namespace tgui
         void moveWidgetToBack(const Widget::Ptr& widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the container uses a grid to find the widget below the mouse
+        ///
+        /// @param enabled  Should child widgets be looked up in a spatial index instead of checking every widget?
+        ///
+        /// Without the index, every mouse event checks each child widget until the widget below the mouse is found.
+        /// With the index enabled, only the widgets in the grid cell below the mouse are checked, which is faster when the
+        /// container holds a lot of widgets. The index is rebuilt when a child widget is added, removed, moved or resized.
+        ///
+        /// Widgets that can receive mouse events outside their position and size (e.g. a slider thumb, the text next to a
+        /// radio button or custom widgets) are not stored in the grid, they are still checked for every mouse event.
+        ///
+        /// The spatial index is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the container uses a grid to find the widget below the mouse
+        ///
+        /// @return Are child widgets looked up in a spatial index?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSpatialIndexEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the child widgets are drawn on a texture that is reused until one of them changes
+        ///
+        /// @param cached  Should the child widgets be drawn on a cached texture?
+        ///
+        /// When enabled, the child widgets are drawn on an internal render texture, and the container only draws this texture
+        /// in the following frames. The texture is drawn again when one of the widgets inside the container is added, removed,
+        /// moved or changes its appearance. This makes drawing panels whose contents rarely change (e.g. toolbars or settings
+        /// pages) about as cheap as drawing a single picture.
+        ///
+        /// The texture covers the area between the origin of the container and the bottom right corner of the child widgets,
+        /// at one pixel per unit. Anything that child widgets draw outside their own area may thus be cut off, and the widgets
+        /// may look blurry when the gui view is zoomed in. Cached rendering is disabled by default.
+        ///
+        /// @see Widget::invalidate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCachedRendering(bool cached);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the child widgets are drawn on a texture that is reused until one of them changes
+        ///
+        /// @return Is cached rendering enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getCachedRendering() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times the child widgets were drawn on the cached texture
+        ///
+        /// @return Number of times that the cached texture had to be updated since cached rendering was enabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getCachedRenderingUpdateCount() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -373,6 +499,14 @@ namespace tgui
         Widget::Ptr askToolTip(Vector2f mousePos) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Called by child widgets when an area has to be drawn again. The rectangle is relative to the position of the child
+        // widgets and is passed to the parent after being translated to its coordinates.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidateChildRegion(FloatRect rect);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -383,7 +517,7 @@ namespace tgui
         /// @param property  Lowercase name of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -448,12 +582,44 @@ namespace tgui
         Widget::Ptr mouseOnWhichWidget(Vector2f mousePos);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Puts the indices of the child widgets in the grid cells that they overlap.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSpatialIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the amount of widgets with the given name inside this container and all of its parents.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void changeSubtreeNameCount(const sf::String& widgetName, int change);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds (change = 1) or subtracts (change = -1) the name of a child widget, and the names of all widgets inside it when
+        // it is a container, to the names counted by this container and all of its parents.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void changeSubtreeNameCounts(const Widget::Ptr& widget, const sf::String& widgetName, int change);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function will call the draw function from all the widgets.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the visible child widgets on the target. When an area is given, the widgets that lie completely outside of it
+        // are skipped.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawChildWidgets(sf::RenderTarget& target, const sf::RenderStates& states, const FloatRect* visibleArea = nullptr) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the child widgets on the cached texture when they changed. Returns false when the texture can't be used.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateRenderCache() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Find out what the index of the focused widget is. Returns 0 when no widget is focused and index+1 otherwise.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -472,6 +638,30 @@ namespace tgui
         // Did we enter handleEvent directly or because we got a MouseReleased event?
         bool m_handingMouseReleased = false;
 
+        // Grid of widget indices, used by mouseOnWhichWidget when the spatial index is enabled.
+        // Widgets that can't be stored in the grid are listed separately and are always checked.
+        bool m_spatialIndexEnabled = false;
+        bool m_spatialIndexNeedsUpdate = true;
+        float m_spatialIndexCellSize = 1;
+        std::size_t m_spatialIndexWidgetCount = 0;
+        std::unordered_map<std::uint64_t, std::vector<std::size_t>> m_spatialIndexCells;
+        std::vector<std::size_t> m_spatialIndexUnindexedWidgets;
+
+        friend class Widget; // Widget tells its parent that the spatial index is outdated when it is moved or resized
+
+        // Index of the first direct child with each name, rebuilt when widgets are removed, renamed or reordered
+        mutable std::unordered_map<sf::String, std::size_t, StringHash> m_widgetNameIndex;
+        mutable bool m_widgetNameIndexNeedsUpdate = false;
+
+        // The amount of widgets with each name inside this container, including widgets inside child containers
+        std::unordered_map<sf::String, unsigned int, StringHash> m_subtreeNameCounts;
+
+        // Texture on which the child widgets are drawn when cached rendering is enabled
+        bool m_cachedRendering = false;
+        mutable bool m_renderCacheNeedsUpdate = true;
+        mutable unsigned int m_renderCacheUpdateCount = 0;
+        mutable std::unique_ptr<sf::RenderTexture> m_renderCache;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -518,6 +708,21 @@ namespace tgui
         bool mouseOnWidget(Vector2f pos) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Stores the area that has to be drawn again when the gui keeps track of the dirty regions.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateChildRegion(FloatRect rect) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Combines the overlapping dirty regions. When there are still too many regions afterwards, they are replaced by a
+        // single region that contains all of them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mergeDirtyRegions();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -542,6 +747,10 @@ namespace tgui
 
         friend class Gui; // Required to let Gui access protected members from container and Widget
 
+        // Areas that changed since the gui was last drawn, only stored when partial redrawing is enabled in the gui
+        bool m_dirtyRegionTrackingEnabled = false;
+        std::vector<FloatRect> m_dirtyRegions;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -0,0 +1,144 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_GLYPH_METRICS_HPP
+#define TGUI_GLYPH_METRICS_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/System/String.hpp>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Caches the horizontal metrics of the glyphs of a font, for a specific character size and boldness
+    ///
+    /// Asking sf::Font for a glyph or a kerning requires several lookups inside the font for every character. This class only
+    /// asks the font the first time a character is measured. The advances of the first 256 code points are kept in a flat
+    /// array, other characters and kerning pairs are kept in hash maps.
+    ///
+    /// The metrics are shared between all texts that use the same font, character size and boldness.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API GlyphMetrics
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param font           Font of which the glyphs will be measured
+        /// @param characterSize  Character size of the text
+        /// @param bold           Is the text bold?
+        ///
+        /// You should normally use the get function instead, which shares the metrics between texts.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GlyphMetrics(const std::shared_ptr<sf::Font>& font, unsigned int characterSize, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the shared metrics of a font for a given character size and boldness
+        ///
+        /// @param font           Font of which the glyphs will be measured
+        /// @param characterSize  Character size of the text
+        /// @param bold           Is the text bold?
+        ///
+        /// @return Cached metrics, or nullptr when no font was given
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<GlyphMetrics> get(const std::shared_ptr<sf::Font>& font, unsigned int characterSize, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the horizontal offset to move to the next character
+        ///
+        /// @param codePoint  Character to measure
+        ///
+        /// @return Advance of the glyph (a tab is as wide as 4 spaces)
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getAdvance(std::uint32_t codePoint);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the kerning offset between two characters
+        ///
+        /// @param first   Previous character
+        /// @param second  Current character
+        ///
+        /// @return Kerning that has to be added to the position of the second character
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getKerning(std::uint32_t first, std::uint32_t second);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calculates the running sum of the widths of the characters in a string
+        ///
+        /// @param text       The text to measure
+        /// @param offsets    Vector that will be filled with text.getSize() + 1 offsets
+        ///
+        /// The element at index i contains the width of the first i characters, where every character adds its advance and its
+        /// kerning with the previous character. The width starts again from 0 after every newline, so for a text without
+        /// newlines the last element is the width of the whole text.
+        ///
+        /// Since the offsets are increasing within a line, the character at a certain position can be found with a binary search.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void getCharacterOffsets(const sf::String& text, std::vector<float>& offsets);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::weak_ptr<sf::Font> m_font;
+        unsigned int m_characterSize;
+        bool m_bold;
+
+        // Advances of the first 256 code points, negative when the glyph hasn't been measured yet
+        std::array<float, 256> m_latinAdvances;
+
+        std::unordered_map<std::uint32_t, float> m_advances;
+        std::unordered_map<std::uint64_t, float> m_kernings;
+
+        static std::map<std::tuple<const sf::Font*, unsigned int, bool>, std::shared_ptr<GlyphMetrics>> m_sharedMetrics;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_GLYPH_METRICS_HPP
@@ -29,6 +29,8 @@
 
 #include <TGUI/Container.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <memory>
 #include <queue>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -141,10 +143,65 @@ namespace tgui
         ///
         /// You should call this function in your event loop.
         ///
+        /// When the event queue is enabled, the event is only stored and this function always returns false.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool handleEvent(sf::Event event);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether events are stored and only passed to the widgets once per frame
+        ///
+        /// @param enabled  Should handleEvent queue the events until processEventQueue or draw is called?
+        ///
+        /// Mice with a high polling rate can report many mouse moves per frame, while only the last one matters to most widgets.
+        /// With the queue enabled, consecutive mouse move events replace each other in the queue, except while a mouse button
+        /// is held down so that widgets being dragged still see the full path of the mouse. Other events are kept in order.
+        ///
+        /// Since the events are handled later, handleEvent can no longer tell whether the event was consumed by a widget.
+        /// Events still in the queue are processed when the queue is disabled. The event queue is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setEventQueueEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether events are stored and only passed to the widgets once per frame
+        ///
+        /// @return Does handleEvent queue the events until processEventQueue or draw is called?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isEventQueueEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Passes all queued events to the widgets
+        ///
+        /// This function is called automatically by the draw function. You only need to call it yourself when you want the
+        /// widgets to react to the events before drawing.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void processEventQueue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of events that are waiting in the queue
+        ///
+        /// @return Number of events that will be handled during the next call to processEventQueue
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getQueuedEventCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of mouse move events that were dropped because a newer one replaced them in the queue
+        ///
+        /// @return Number of coalesced mouse move events since the gui was created
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getCoalescedEventCount() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws all the widgets that were added to the gui
         ///
@@ -152,6 +209,88 @@ namespace tgui
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the widgets are drawn in batches
+        ///
+        /// @param enabled  Should the geometry of consecutive widgets be combined to reduce the amount of draw calls?
+        ///
+        /// When enabled, widgets that use the same texture are drawn with a single draw call instead of one call per part of
+        /// each widget. Widgets that draw custom content (e.g. Canvas) interrupt the batch. This is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBatchedRenderingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the widgets are drawn in batches
+        ///
+        /// @return Is batched rendering enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isBatchedRenderingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether only the parts of the gui that changed are drawn again
+        ///
+        /// @param enabled  Should the widgets be drawn on a cached texture of which only the changed areas are updated?
+        ///
+        /// When enabled, the widgets are drawn on an internal render texture with the same size as the render target. Widgets
+        /// tell the gui which area has to be drawn again when they change (e.g. when their text, state or renderer changes), and
+        /// the draw function only draws the widgets inside these areas on the texture. The texture is then drawn on the target
+        /// with a single quad. This saves time when most of the gui stays the same between frames.
+        ///
+        /// If you change the appearance of a widget in a way that it can't detect itself (e.g. by drawing on a canvas without
+        /// calling its display function), then you have to call invalidate() on the widget. This is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPartialRedrawEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether only the parts of the gui that changed are drawn again
+        ///
+        /// @return Is partial redrawing enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isPartialRedrawEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the areas that will be drawn again during the next call to draw
+        ///
+        /// @return Changed areas, in the coordinates of the view of the gui
+        ///
+        /// The list is always empty when partial redrawing is disabled. It is also empty when nothing changed since the last
+        /// frame, even when the next draw call will draw everything again because e.g. the view or the target size changed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<FloatRect>& getDirtyRegions() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how much time the draw function may spend on creating textures for images that were loaded asynchronously
+        ///
+        /// @param budget  Maximum time per frame to spend on creating textures
+        ///
+        /// At least one texture is created per frame when images are available, even if that takes longer than the budget.
+        /// The default budget is 4 milliseconds.
+        ///
+        /// @see TextureManager::setAsyncLoadingEnabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTextureUploadBudget(sf::Time budget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much time the draw function may spend on creating textures for images that were loaded asynchronously
+        ///
+        /// @return Maximum time per frame to spend on creating textures
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getTextureUploadBudget() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal container of the Gui
         ///
@@ -251,6 +390,64 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget that was added directly to the gui
+        ///
+        /// @param widgetName The name that was given to the widget when it was added to the gui
+        ///
+        /// @return Pointer to the first widget with the given name, or nullptr when there is no such widget
+        ///
+        /// @see Container::getDirect
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getDirect(const sf::String& widgetName) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget that was added directly to the gui
+        ///
+        /// @param widgetName The name that was given to the widget when it was added to the gui
+        ///
+        /// @return Pointer to the first widget with the given name, casted to the desired type.
+        ///         A nullptr is returned when there is no such widget.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T>
+        typename T::Ptr getDirect(const sf::String& widgetName) const
+        {
+            return m_container->getDirect<T>(widgetName);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget inside the gui or inside one of its containers
+        ///
+        /// @param widgetName The name that was given to the widget when it was added to its container
+        ///
+        /// @return Pointer to the widget with the given name, or nullptr when there is no such widget
+        ///
+        /// @see Container::getRecursive
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getRecursive(const sf::String& widgetName) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget inside the gui or inside one of its containers
+        ///
+        /// @param widgetName The name that was given to the widget when it was added to its container
+        ///
+        /// @return Pointer to the widget with the given name, casted to the desired type.
+        ///         A nullptr is returned when there is no such widget.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T>
+        typename T::Ptr getRecursive(const sf::String& widgetName) const
+        {
+            return m_container->getRecursive<T>(widgetName);
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes a single widget that was added to the container
         ///
@@ -406,6 +603,12 @@ namespace tgui
         void updateTime(const sf::Time& elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      public:
+
+        Signal onTexturesLoaded = {"TexturesLoaded"}; ///< All images that were being loaded asynchronously are ready to be drawn
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       private:
 
@@ -415,6 +618,31 @@ namespace tgui
         void init();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the event to the queue, or replaces the last event when both are mouse moves and no mouse button is down
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void queueEvent(const sf::Event& event);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes the event to the widgets, this is what handleEvent does when the event queue is disabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool dispatchEvent(sf::Event event);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the widgets on the given target, which should already be using the correct view. When an area is given, only
+        // the widgets that overlap with it are drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawWidgets(sf::RenderTarget& target, const FloatRect* visibleArea = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the dirty regions on the cached texture and then draws the texture on the target
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawPartially();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -439,6 +667,21 @@ namespace tgui
 
         sf::View m_view;
 
+        bool m_batchedRendering = false;
+
+        bool m_partialRedraw = false;
+        bool m_fullRedrawNeeded = true;
+        std::unique_ptr<sf::RenderTexture> m_cacheTexture;
+
+        sf::Time m_textureUploadBudget = sf::milliseconds(4);
+        bool m_texturesLoading = false;
+
+        bool m_eventQueueEnabled = false;
+        std::vector<sf::Event> m_eventQueue;
+        std::vector<sf::Event> m_eventsBeingProcessed;
+        bool m_mouseDownInEventQueue = false; // Was the last mouse button or touch event in the queue a press?
+        std::size_t m_coalescedEventCount = 0;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -231,6 +231,8 @@ namespace tgui
         std::string m_boundString; // String referring  to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
         std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
 
+        friend class LayoutSolver; // LayoutSolver looks at the bound widgets to determine the order in which widgets are updated
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
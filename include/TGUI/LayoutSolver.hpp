@@ -0,0 +1,146 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_LAYOUT_SOLVER_HPP
+#define TGUI_LAYOUT_SOLVER_HPP
+
+#include <TGUI/Config.hpp>
+#include <unordered_map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+    class Layout;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Delays the updates of widgets whose position or size depends on other widgets
+    ///
+    /// By default a widget is updated immediately when a widget that it is bound to moves or changes size. When the layout of
+    /// a widget depends on several widgets that change at the same time, it is then updated several times in a row.
+    ///
+    /// When deferred updates are enabled, the layout values are still recalculated immediately but the widgets are only
+    /// marked as dirty. They are updated when flush is called, which the gui does in its draw and handleEvent functions.
+    /// The dirty widgets are updated in the order of their dependencies, so that every widget only has to be updated once.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API LayoutSolver
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether widgets are updated immediately or only when flush is called
+        ///
+        /// @param enabled  Should updates to bound widgets be postponed until the next flush?
+        ///
+        /// Pending updates are executed immediately when deferred updates are disabled. Deferred updates are disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setDeferredUpdatesEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether widgets are only updated when flush is called
+        ///
+        /// @return Are updates to bound widgets postponed until the next flush?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isDeferredUpdatesEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Updates the position and size of all widgets that were marked as dirty
+        ///
+        /// Widgets are updated after the widgets on which they depend. A warning is printed when the layouts contain a cycle.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void flush();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of widgets that are waiting for the next flush
+        ///
+        /// @return Number of dirty widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getPendingCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times a position or size was updated during the last flush
+        ///
+        /// @return Number of calls to setPosition and setSize made by the last call to flush
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int getUpdateCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Tells the solver that the position layout of the widget has changed
+        ///
+        /// The position of the widget is updated immediately when deferred updates are disabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void positionChanged(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Tells the solver that the size layout of the widget has changed
+        ///
+        /// The size of the widget is updated immediately when deferred updates are disabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void sizeChanged(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Forgets about the widget when it is destroyed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeWidget(Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Adds the widgets on which the layout depends to the list
+        static void addDependencies(const Layout& layout, std::vector<Widget*>& dependencies);
+
+        // Adds the dirty widgets to the update order after the dirty widgets on which they depend, returns false on a cycle
+        static bool sortWidget(Widget* widget, std::unordered_map<Widget*, unsigned int>& visited, std::vector<Widget*>& order);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        static bool m_deferredUpdatesEnabled;
+        static bool m_flushing;
+        static unsigned int m_updateCount;
+        static std::unordered_map<Widget*, unsigned int> m_dirtyWidgets;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_LAYOUT_SOLVER_HPP
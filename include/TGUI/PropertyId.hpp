@@ -0,0 +1,268 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_PROPERTY_ID_HPP
+#define TGUI_PROPERTY_ID_HPP
+
+#include <TGUI/Config.hpp>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// List of the renderer properties that are used by the widgets in TGUI. The names are the ones used in the getters and
+// setters of the renderer classes, the property names themselves are the lowercase versions of these names.
+#define TGUI_RENDERER_PROPERTIES(X) \
+    X(ArrowBackgroundColor) \
+    X(ArrowBackgroundColorHover) \
+    X(ArrowColor) \
+    X(ArrowColorHover) \
+    X(BackgroundColor) \
+    X(BackgroundColorChecked) \
+    X(BackgroundColorCheckedDisabled) \
+    X(BackgroundColorCheckedHover) \
+    X(BackgroundColorDisabled) \
+    X(BackgroundColorDown) \
+    X(BackgroundColorHover) \
+    X(BorderColor) \
+    X(BorderColorChecked) \
+    X(BorderColorCheckedDisabled) \
+    X(BorderColorCheckedHover) \
+    X(BorderColorDisabled) \
+    X(BorderColorDown) \
+    X(BorderColorHover) \
+    X(Borders) \
+    X(Button) \
+    X(CaretColor) \
+    X(CaretColorDisabled) \
+    X(CaretColorHover) \
+    X(CaretWidth) \
+    X(CheckColor) \
+    X(CheckColorDisabled) \
+    X(CheckColorHover) \
+    X(CloseButton) \
+    X(DefaultTextColor) \
+    X(DefaultTextStyle) \
+    X(DistanceToSide) \
+    X(FillColor) \
+    X(Font) \
+    X(IgnoreTransparentParts) \
+    X(ImageRotation) \
+    X(ListBox) \
+    X(MaximizeButton) \
+    X(MinimizeButton) \
+    X(Opacity) \
+    X(Padding) \
+    X(PaddingBetweenButtons) \
+    X(Scrollbar) \
+    X(SelectedBackgroundColor) \
+    X(SelectedBackgroundColorHover) \
+    X(SelectedTextBackgroundColor) \
+    X(SelectedTextColor) \
+    X(SelectedTextColorHover) \
+    X(SelectedTextStyle) \
+    X(SelectedTrackColor) \
+    X(SelectedTrackColorHover) \
+    X(ShowTextOnTitleButtons) \
+    X(SpaceBetweenArrows) \
+    X(SpaceBetweenWidgets) \
+    X(TextColor) \
+    X(TextColorChecked) \
+    X(TextColorCheckedDisabled) \
+    X(TextColorCheckedHover) \
+    X(TextColorDisabled) \
+    X(TextColorDown) \
+    X(TextColorFilled) \
+    X(TextColorHover) \
+    X(TextDistanceRatio) \
+    X(TextStyle) \
+    X(TextStyleChecked) \
+    X(TextStyleDisabled) \
+    X(TextStyleDown) \
+    X(TextStyleHover) \
+    X(Texture) \
+    X(TextureArrow) \
+    X(TextureArrowDown) \
+    X(TextureArrowDownHover) \
+    X(TextureArrowHover) \
+    X(TextureArrowUp) \
+    X(TextureArrowUpHover) \
+    X(TextureBackground) \
+    X(TextureChecked) \
+    X(TextureCheckedDisabled) \
+    X(TextureCheckedHover) \
+    X(TextureDisabled) \
+    X(TextureDown) \
+    X(TextureFill) \
+    X(TextureFocused) \
+    X(TextureForeground) \
+    X(TextureHover) \
+    X(TextureItemBackground) \
+    X(TextureSelectedItemBackground) \
+    X(TextureSelectedTab) \
+    X(TextureTab) \
+    X(TextureThumb) \
+    X(TextureThumbHover) \
+    X(TextureTitleBar) \
+    X(TextureTrack) \
+    X(TextureTrackHover) \
+    X(TextureUnchecked) \
+    X(TextureUncheckedDisabled) \
+    X(TextureUncheckedHover) \
+    X(ThumbColor) \
+    X(ThumbColorHover) \
+    X(TitleBarColor) \
+    X(TitleBarHeight) \
+    X(TitleColor) \
+    X(TrackColor) \
+    X(TrackColorHover)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace Property
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Identifiers of the renderer properties that are used by the widgets in TGUI
+        ///
+        /// These values can be used as case labels when switching on PropertyId::getId().
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum Id : unsigned int
+        {
+            None, ///< Empty property name
+        #define TGUI_PROPERTY_ID_ENUM_VALUE(NAME) NAME,
+            TGUI_RENDERER_PROPERTIES(TGUI_PROPERTY_ID_ENUM_VALUE)
+        #undef TGUI_PROPERTY_ID_ENUM_VALUE
+            Count ///< Amount of predefined properties, property names that are interned later get higher ids
+        };
+    }
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Interned name of a renderer property
+    ///
+    /// Every distinct property name is stored once in a global table and gets a unique integer id. Copying and comparing
+    /// property ids thus never touches the string. The properties used by TGUI have a fixed id from the Property namespace,
+    /// other names are given the next free id the first time they are used.
+    ///
+    /// Property names are case-sensitive here, the renderer converts the names that it receives to lowercase.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API PropertyId
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor that creates the id of an empty property name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_CONSTEXPR PropertyId() :
+            m_id{Property::None}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the id of one of the properties used by TGUI
+        ///
+        /// @param id  Predefined property id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_CONSTEXPR PropertyId(Property::Id id) :
+            m_id{id}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the id of a property name, adding the name to the table if it wasn't used before
+        ///
+        /// @param name  Name of the property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyId(const std::string& name);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the id of a property name, adding the name to the table if it wasn't used before
+        ///
+        /// @param name  Name of the property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyId(const char* name);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the integer id of the property
+        ///
+        /// @return Id that can be compared with the values from the Property namespace
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_CONSTEXPR unsigned int getId() const
+        {
+            return m_id;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the name of the property
+        ///
+        /// @return Property name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::string& getName() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        unsigned int m_id;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Checks whether two property ids refer to the same property name
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    inline TGUI_CONSTEXPR bool operator==(const PropertyId& left, const PropertyId& right)
+    {
+        return left.getId() == right.getId();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Checks whether two property ids refer to different property names
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    inline TGUI_CONSTEXPR bool operator!=(const PropertyId& left, const PropertyId& right)
+    {
+        return left.getId() != right.getId();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Orders property ids by their integer id, so that they can be used as key in a map
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    inline TGUI_CONSTEXPR bool operator<(const PropertyId& left, const PropertyId& right)
+    {
+        return left.getId() < right.getId();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROPERTY_ID_HPP
@@ -29,6 +29,7 @@
 
 #include <TGUI/Config.hpp>
 #include <TGUI/ObjectConverter.hpp>
+#include <TGUI/PropertyId.hpp>
 #include <TGUI/Loading/DataIO.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -45,7 +46,8 @@ namespace tgui
         static std::shared_ptr<RendererData> create(const std::map<std::string, ObjectConverter>& init = {})
         {
             auto data = std::make_shared<RendererData>();
-            data->propertyValuePairs = init;
+            for (const auto& pair : init)
+                data->propertyValuePairs[pair.first] = pair.second;
             return data;
         }
 
@@ -68,8 +70,8 @@ namespace tgui
             return rendererData;
         };
 
-        std::map<std::string, ObjectConverter> propertyValuePairs;
-        std::map<const void*, std::function<void(const std::string& property)>> observers;
+        std::map<PropertyId, ObjectConverter> propertyValuePairs;
+        std::map<const void*, std::function<void(PropertyId property)>> observers;
         bool shared = true;
     };
 
@@ -157,6 +159,18 @@ namespace tgui
         void setProperty(const std::string& property, ObjectConverter&& value);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes one of the properties used by TGUI, without having to look up the property name
+        ///
+        /// @param property  Id of the property that you would like to change
+        /// @param value     The new value that you like to assign to the property
+        ///
+        /// @throw Exception for unknown properties or when value was of a wrong type
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setProperty(Property::Id property, ObjectConverter&& value);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves the value of a certain property
         ///
@@ -175,7 +189,7 @@ namespace tgui
         /// @return Property-value pairs of the renderer
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::map<std::string, ObjectConverter>& getPropertyValuePairs() const;
+        const std::map<PropertyId, ObjectConverter>& getPropertyValuePairs() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -185,7 +199,7 @@ namespace tgui
         /// @param function Callback function to call when the renderer changes
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void subscribe(const void* id, const std::function<void(const std::string& property)>& function);
+        void subscribe(const void* id, const std::function<void(PropertyId property)>& function);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +33,7 @@
 #include <SFML/System/String.hpp>
 #include <functional>
 #include <typeindex>
+#include <unordered_map>
 #include <memory>
 #include <vector>
 #include <deque>
@@ -46,11 +47,6 @@ namespace tgui
     class ChildWindow;
     class SignalWidgetBase;
 
-    namespace internal_signal
-    {
-        extern TGUI_API std::deque<const void*> parameters;
-    }
-
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Signal to which the user can subscribe to get callbacks from
@@ -62,21 +58,37 @@ namespace tgui
         using Delegate = std::function<void()>;
         using DelegateEx = std::function<void(std::shared_ptr<Widget>, const std::string&)>;
 
+        // Handlers that are stored in the signal are given a list with pointers to the parameters of the emit
+        using Handler = std::function<void(const void* const* parameters)>;
+
 
         virtual ~Signal() = default;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param name  Name of the signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Signal(std::string&& name) :
+            m_name{std::move(name)}
+        {
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         ///
         /// @param name             Name of the signal
-        /// @param extraParameters  Amount of extra parameters to reserve space for
+        /// @param extraParameters  Ignored, the parameters are no longer stored outside the emit function
+        ///
+        /// @deprecated Use the constructor that only takes the name instead
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal(std::string&& name, std::size_t extraParameters = 0) :
+        TGUI_DEPRECATED("The amount of extra parameters no longer has to be passed to the Signal constructor")
+        Signal(std::string&& name, std::size_t extraParameters) :
             m_name{std::move(name)}
         {
-            if (1 + extraParameters > internal_signal::parameters.size())
-                internal_signal::parameters.resize(1 + extraParameters);
+            (void)extraParameters;
         }
 
 
@@ -147,20 +159,7 @@ namespace tgui
         ///
         /// @return True when at least one signal handler was called
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        bool emit(const Widget* widget)
-        {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[0] = static_cast<const void*>(&widget);
-
-            // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
-            auto handlers = m_handlers;
-            for (auto& handler : handlers)
-                handler.second();
-
-            return true;
-        }
+        bool emit(const Widget* widget);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -174,6 +173,17 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Connects a handler that reads the parameters of the emit itself
+        ///
+        /// @param handler  Callback function that is given the list of parameters, of which the first one is the widget
+        ///
+        /// @return Unique id of the connection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int connectWithParameters(Handler&& handler);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Checks whether the unbound parameters match with this signal
@@ -182,21 +192,63 @@ namespace tgui
         virtual unsigned int validateTypes(std::initializer_list<std::type_index> unboundParameters);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Extracts the widget stored in the first parameter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<Widget> getWidget(const void* const* parameters);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Extracts the widget stored in the first parameter
+        /// @brief Calls all connected signal handlers with the given parameters
+        ///
+        /// The parameters are passed on the stack of the emitting thread, which allows emitting from within a signal handler.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool callHandlers(const void* const* parameters);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Stores a handler that will be called when the signal is emitted
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static std::shared_ptr<Widget> getWidget();
+        void addHandler(unsigned int id, Handler&& handler);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns whether there are handlers that would be called when emitting the signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool hasHandlers() const
+        {
+            return m_handlers && (m_handlers->connectedCount > 0);
+        }
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        struct ConnectedHandler
+        {
+            unsigned int id;
+            Handler function;
+            bool connected;
+        };
+
+        // The handlers are stored in a deque so that connecting a handler while the signal is being emitted doesn't move the
+        // handlers that are being called. Disconnected handlers are only removed once the signal is no longer being emitted.
+        struct HandlerList
+        {
+            std::deque<ConnectedHandler> handlers;
+            std::size_t connectedCount = 0;
+            unsigned int emitDepth = 0;
+        };
+
         std::string m_name;
-        std::map<unsigned int, std::function<void()>> m_handlers;
+        std::shared_ptr<HandlerList> m_handlers; // Only created when the first handler is connected
     };
 
 
@@ -215,7 +267,7 @@ namespace tgui
          * @brief Constructor
          ************************************************************************************************************************/ \
         Signal##TypeName(std::string&& name) : \
-            Signal{std::move(name), 1} \
+            Signal{std::move(name)} \
         { \
         } \
         \
@@ -243,11 +295,11 @@ namespace tgui
          ************************************************************************************************************************/ \
         bool emit(const Widget* widget, Type strParam) \
         { \
-            if (m_handlers.empty()) \
+            if (!hasHandlers()) \
                 return false; \
          \
-            internal_signal::parameters[1] = static_cast<const void*>(&strParam); \
-            return Signal::emit(widget); \
+            const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&strParam)}; \
+            return callHandlers(parameters); \
         } \
         \
         /************************************************************************************************************************ \
@@ -284,7 +336,7 @@ namespace tgui
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalRange(std::string&& name) :
-            Signal{std::move(name), 2}
+            Signal{std::move(name)}
         {
         }
 
@@ -345,7 +397,7 @@ namespace tgui
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalChildWindow(std::string&& name) :
-            Signal{std::move(name), 1}
+            Signal{std::move(name)}
         {
         }
 
@@ -408,7 +460,7 @@ namespace tgui
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalItem(std::string&& name) :
-            Signal{std::move(name), 2}
+            Signal{std::move(name)}
         {
         }
 
@@ -459,12 +511,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const sf::String& item, const sf::String& id)
         {
-            if (m_handlers.empty())
+            if (!hasHandlers())
                 return false;
 
-            internal_signal::parameters[1] = static_cast<const void*>(&item);
-            internal_signal::parameters[2] = static_cast<const void*>(&id);
-            return Signal::emit(widget);
+            const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&item), static_cast<const void*>(&id)};
+            return callHandlers(parameters);
         }
 
 
@@ -499,7 +550,7 @@ namespace tgui
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalMenuItem(std::string&& name) :
-            Signal{std::move(name), 2}
+            Signal{std::move(name)}
         {
         }
 
@@ -550,12 +601,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const sf::String& item, const std::vector<sf::String>& fullItem)
         {
-            if (m_handlers.empty())
+            if (!hasHandlers())
                 return false;
 
-            internal_signal::parameters[1] = static_cast<const void*>(&item);
-            internal_signal::parameters[2] = static_cast<const void*>(&fullItem);
-            return Signal::emit(widget);
+            const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&item), static_cast<const void*>(&fullItem)};
+            return callHandlers(parameters);
         }
 
 
@@ -681,6 +731,33 @@ namespace tgui
         virtual Signal& getSignal(std::string signalName) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function that returns a signal of a widget of the given type
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename WidgetType>
+        using SignalGetter = Signal& (*)(WidgetType&);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a map from the lowercase names of signals to functions that return these signals
+        ///
+        /// @param widget   Widget from which the signal names are read
+        /// @param getters  Functions that return the signals of a widget
+        ///
+        /// All widgets of the same type have the same signal names, so getSignal can store this map in a static variable
+        /// that is shared by all widgets and that is created the first time a signal is requested.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename WidgetType>
+        static std::unordered_map<std::string, SignalGetter<WidgetType>> createSignalMap(WidgetType& widget, std::initializer_list<SignalGetter<WidgetType>> getters)
+        {
+            std::unordered_map<std::string, SignalGetter<WidgetType>> signalMap;
+            for (const auto& getter : getters)
+                signalMap[toLower(getter(widget).getName())] = getter;
+
+            return signalMap;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
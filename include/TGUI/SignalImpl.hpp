@@ -150,7 +150,7 @@ namespace tgui
         template <typename...>
         struct TypeSet;
 
-        // The dereference function turns the void* elements in the parameters list back into its original type right before calling the signal handler
+        // The dereference function turns the void* elements in the parameters list of an emit back into its original type right before calling the signal handler
 #ifdef TGUI_USE_CPP17
         template <typename Type>
         decltype(auto) dereference(const void* obj)
@@ -227,7 +227,7 @@ namespace tgui
         {
             template <typename Func, typename... BoundArgs>
         #ifdef TGUI_NO_CPP14
-            static std::function<void(const std::shared_ptr<Widget>& widget, const std::string& signalName)> bind(Signal& signal, Func&& func, BoundArgs&&... args)
+            static Signal::Handler bind(Signal& signal, Func&& func, BoundArgs&&... args)
         #else
             static decltype(auto) bind(Signal& signal, Func&& func, BoundArgs&&... args)
         #endif
@@ -239,27 +239,28 @@ namespace tgui
 
             template <typename Func, typename... BoundArgs, std::size_t... Indices>
         #ifdef TGUI_NO_CPP14
-            static std::function<void(const std::shared_ptr<Widget>& widget, const std::string& signalName)> bindImpl(index_sequence<Indices...>, Signal& signal, Func&& func, BoundArgs&&... args)
+            static Signal::Handler bindImpl(index_sequence<Indices...>, Signal& signal, Func&& func, BoundArgs&&... args)
         #else
             static decltype(auto) bindImpl(index_sequence<Indices...>, Signal& signal, Func&& func, BoundArgs&&... args)
         #endif
             {
                 const std::size_t offset = (sizeof...(UnboundArgs) > 0) ? signal.validateTypes({typeid(UnboundArgs)...}) : 0;
+                const std::string signalName = signal.getName();
             #ifdef TGUI_NO_CPP14
-                return [=](const std::shared_ptr<Widget>& widget, const std::string& signalName) {
+                return [=](const void* const* parameters) {
                     auto f = func;
                     invokeFunc(f,
             #elif defined TGUI_USE_CPP17
-                return [=](const std::shared_ptr<Widget>& widget, const std::string& signalName) {
+                return [=](const void* const* parameters) {
                     std::invoke(func,
             #else
-                return [=, f=func](const std::shared_ptr<Widget>& widget, const std::string& signalName) { // f=func is needed to decay free functions
+                return [=, f=func](const void* const* parameters) { // f=func is needed to decay free functions
                     invokeFunc(f,
             #endif
                                args...,
-                               widget,
+                               Signal::getWidget(parameters),
                                signalName,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[offset + Indices])...);
+                               internal_signal::dereference<UnboundArgs>(parameters[offset + Indices])...);
                 };
             }
         };
@@ -269,7 +270,7 @@ namespace tgui
         {
             template <typename Func, typename... BoundArgs>
         #ifdef TGUI_NO_CPP14
-            static std::function<void()> bind(Signal& signal, Func&& func, BoundArgs&&... args)
+            static Signal::Handler bind(Signal& signal, Func&& func, BoundArgs&&... args)
         #else
             static decltype(auto) bind(Signal& signal, Func&& func, BoundArgs&&... args)
         #endif
@@ -281,25 +282,28 @@ namespace tgui
 
             template <typename Func, typename... BoundArgs, std::size_t... Indices>
         #ifdef TGUI_NO_CPP14
-            static std::function<void()> bindImpl(index_sequence<Indices...>, Signal& signal, Func&& func, BoundArgs&&... args)
+            static Signal::Handler bindImpl(index_sequence<Indices...>, Signal& signal, Func&& func, BoundArgs&&... args)
         #else
             static decltype(auto) bindImpl(index_sequence<Indices...>, Signal& signal, Func&& func, BoundArgs&&... args)
         #endif
             {
                 const std::size_t offset = (sizeof...(UnboundArgs) > 0) ? signal.validateTypes({typeid(UnboundArgs)...}) : 0;
             #ifdef TGUI_NO_CPP14
-                return [=]() {
+                return [=](const void* const* parameters) {
+                    (void)parameters; // Unused when all parameters are bound
                     auto f = func;
                     invokeFunc(f,
             #elif defined TGUI_USE_CPP17
-                return [=]() {
+                return [=](const void* const* parameters) {
+                    (void)parameters; // Unused when all parameters are bound
                     std::invoke(func,
             #else
-                return [=, f=func]() {  // f=func is needed to decay free functions
+                return [=, f=func](const void* const* parameters) {  // f=func is needed to decay free functions
+                    (void)parameters; // Unused when all parameters are bound
                     invokeFunc(f,
             #endif
                                args...,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[offset + Indices])...);
+                               internal_signal::dereference<UnboundArgs>(parameters[offset + Indices])...);
                 };
             }
         };
@@ -443,7 +447,7 @@ namespace tgui
         {
             // Function with unbound arguments
             using binder = internal_signal::func_traits<void, std::decay_t<Func>, BoundArgs...>;
-            id = signal.connect(binder::bind(signal, std::forward<Func>(handler), args...));
+            id = signal.connectWithParameters(binder::bind(signal, std::forward<Func>(handler), args...));
         }
 
         m_connectedSignals[id] = toLower(signalName);
@@ -490,7 +494,7 @@ namespace tgui
     {
         Signal& signal = getSignal(toLower(signalName));
         using binder = internal_signal::func_traits<void, typename std::decay<Func>::type, BoundArgs...>;
-        const unsigned int id = signal.connect(binder::bind(signal, std::forward<Func>(handler), std::forward<BoundArgs>(args)...));
+        const unsigned int id = signal.connectWithParameters(binder::bind(signal, std::forward<Func>(handler), std::forward<BoundArgs>(args)...));
         m_connectedSignals[id] = toLower(signalName);
         return id;
     }
@@ -92,6 +92,8 @@ namespace tgui
         ///
         /// @param Has a valid texture been assigned to this sprite?
         ///
+        /// When the texture is still being loaded asynchronously, this function returns false until the image is ready.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool isSet() const;
 
@@ -214,7 +216,14 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update the location of the vertices
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateVertices();
+        void updateVertices() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Update the vertices when the texture was still being loaded the last time they were updated and it has finished now,
+        // or when the texture coordinates still point inside an atlas that the image no longer belongs to
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVerticesWhenLoaded() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -222,14 +231,16 @@ namespace tgui
 
         Vector2f    m_size;
         Texture     m_texture;
-        std::vector<sf::Vertex> m_vertices;
+        mutable std::vector<sf::Vertex> m_vertices;
+        mutable bool m_textureLoading = false;
+        mutable bool m_textureInAtlas = false;
 
         FloatRect   m_visibleRect;
 
         Color       m_vertexColor = Color::White;
         float       m_opacity = 1;
 
-        ScalingType m_scalingType = ScalingType::Normal;
+        mutable ScalingType m_scalingType = ScalingType::Normal;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,8 @@
 #include <TGUI/TextStyle.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -105,6 +107,24 @@ namespace tgui
         static sf::String wordWrap(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace = true);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// Finds where the lines start when the text is wrapped so that the width does not exceed maxWidth.
+        ///
+        /// @param maxWidth         Maximum width of the text
+        /// @param text             The text to wrap
+        /// @param font             Font of the text
+        /// @param textSize         The text size
+        /// @param dropLeadingSpace Should a single space at the beginning of a line be moved to the end of the previous line?
+        ///
+        /// @return Index of the first character of every line except the first one. A line that ends with a newline contains
+        ///         that newline, so the text can be split into lines without copying it.
+        ///
+        /// The wordWrap function inserts a newline at each of these positions, except where the text already contains one.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::vector<std::size_t> findLineBreaks(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace = true);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -263,6 +283,12 @@ namespace tgui
         void recalculateSize();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Builds the triangles of the glyphs, which are needed when the text is drawn as part of a vertex batch
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVertices() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -271,6 +297,9 @@ namespace tgui
         Font         m_font;
         Color        m_color;
         float        m_opacity = 1;
+
+        mutable std::vector<sf::Vertex> m_vertices;
+        mutable bool m_verticesNeedUpdate = true;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
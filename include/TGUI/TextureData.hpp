@@ -37,6 +37,9 @@
 
 #include <memory>
 #include <string>
+#include <vector>
+#include <list>
+#include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -44,17 +47,17 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    // Used by the Texture class
-    struct TGUI_API TextureData
+    // Stores which pixels of an image are transparent, using a single bit per pixel
+    struct TGUI_API AlphaMask
     {
-        std::unique_ptr<sf::Image> image;
-        sf::Texture texture;
-        sf::IntRect rect;
-        sf::Shader* shader = nullptr;
+        sf::Vector2u size;
+        std::vector<bool> transparent;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    struct TextureData;
+
     // Wrapper around TextureData to be used in TextureManager
     struct TGUI_API TextureDataHolder
     {
@@ -64,6 +67,37 @@ namespace tgui
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Used by the Texture class
+    struct TGUI_API TextureData
+    {
+        // The image is shared between all parts that are loaded from the same file. It is replaced by the alpha mask when the
+        // texture manager is told not to keep the images in memory.
+        std::shared_ptr<sf::Image> image;
+        std::shared_ptr<AlphaMask> alphaMask;
+
+        sf::Texture texture;
+        sf::IntRect rect;
+        sf::Shader* shader = nullptr;
+
+        // When the image was packed in an atlas by the texture manager, the texture member is left empty and the image is
+        // found at atlasRect inside the atlasTexture, which is shared with other images.
+        std::shared_ptr<sf::Texture> atlasTexture;
+        sf::IntRect atlasRect;
+
+        // True while the image is still being decoded on a worker thread of the texture manager. The texture remains empty
+        // until the texture manager creates it on the gui thread.
+        bool loading = false;
+
+        // Position of the holder of this data inside the texture manager, so that the texture manager doesn't have to search
+        // for it when the texture is copied or destroyed. The iterators are only valid when managerHandleValid is true.
+        bool managerHandleValid = false;
+        std::map<std::string, std::list<TextureDataHolder>>::iterator managerImageIt;
+        std::list<TextureDataHolder>::iterator managerHolderIt;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
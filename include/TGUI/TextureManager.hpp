@@ -29,9 +29,11 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/TextureData.hpp>
+#include <SFML/System/Time.hpp>
 #include <memory>
 #include <list>
 #include <map>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -79,10 +81,144 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether images that are loaded are packed together in atlas textures
+        ///
+        /// @param enabled  Should images be packed in atlas textures?
+        ///
+        /// When enabled, the images that are loaded afterwards are copied into a few large textures instead of each getting a
+        /// texture of their own. Widgets that use images from the same atlas can then be drawn together when batched rendering
+        /// is enabled in the gui. A transparent border is not needed between the images, the edge pixels are repeated.
+        ///
+        /// Images that are too large to fit in an atlas are still given their own texture. When the smooth filter is enabled on
+        /// a texture that was packed in an atlas, it is also moved to a texture of its own.
+        ///
+        /// Packing is disabled by default.
+        ///
+        /// @see Gui::setBatchedRenderingEnabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether images that are loaded are packed together in atlas textures
+        ///
+        /// @return Are images packed in atlas textures?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAtlasEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether loaded images are replaced by a mask that only stores which pixels are transparent
+        ///
+        /// @param enabled  Should only an alpha mask be kept instead of the image?
+        ///
+        /// The loaded images are only kept in memory to find out whether the mouse is on a transparent pixel. When this option
+        /// is enabled, the image is released once its texture is created and only a mask with one bit per pixel is kept.
+        /// The downside is that the image has to be loaded from the file again when another part of it is loaded later.
+        ///
+        /// This option is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAlphaMaskEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether loaded images are replaced by a mask that only stores which pixels are transparent
+        ///
+        /// @return Is only an alpha mask kept instead of the image?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAlphaMaskEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether images are loaded on worker threads
+        ///
+        /// @param enabled  Should images be decoded in the background instead of while loading the texture?
+        ///
+        /// When enabled, loading a texture returns immediately with empty texture data. Reading and decoding the file happens
+        /// on worker threads, with the function that was set with Texture::setImageLoader, so that function has to be thread-safe.
+        /// The texture is created from the decoded image on the gui thread, which happens in processLoadedImages (called by
+        /// Gui::draw). All textures that are copied from the loaded texture share the same data, so they get the image as well.
+        ///
+        /// Until the texture is created, widgets are drawn as if the texture wasn't set in their renderer, which usually means
+        /// that they are drawn with the colors from the renderer as placeholder. Once the texture is ready, Gui::draw informs the
+        /// widgets in the gui that use it, so that they can change their look and recalculate the sizes that depend on the image.
+        /// An image that fails to load results in a warning instead of an exception.
+        ///
+        /// This option is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAsyncLoadingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether images are loaded on worker threads
+        ///
+        /// @return Are images decoded in the background?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAsyncLoadingEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates the textures for images that were decoded on the worker threads
+        ///
+        /// @param maxDuration     Time after which no more textures are created during this call
+        /// @param loadedTextures  Optional list to which the texture data is added of which the texture was created
+        ///
+        /// At least one image is processed when one is available, even when the duration has already passed. The remaining
+        /// images are processed during the next call.
+        ///
+        /// @return Amount of images that were processed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int processLoadedImages(sf::Time maxDuration, std::vector<std::shared_ptr<TextureData>>* loadedTextures = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of images that are being loaded on worker threads or are waiting to be processed
+        ///
+        /// @return Number of images of which the textures haven't been created yet
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getLoadingImageCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Creates the texture from the image in the texture data. The alpha mask is created when needed or reused from other
+        // parts of the same image.
+        static bool createTexture(TextureData& data, std::shared_ptr<AlphaMask>& alphaMask);
+
+        // Copies the image of the texture data into an atlas, returns false when it didn't fit
+        static bool addToAtlas(TextureData& data);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Images are placed in an atlas page from left to right on shelves, a new shelf is started below the previous one when
+        // the image no longer fits next to the other images. The page is destroyed when none of its images are used anymore.
+        struct AtlasPage
+        {
+            std::weak_ptr<sf::Texture> texture;
+            unsigned int size = 0;
+            unsigned int shelfTop = 0;
+            unsigned int shelfHeight = 0;
+            unsigned int shelfRight = 0;
+        };
+
         static std::map<std::string, std::list<TextureDataHolder>> m_imageMap;
+        static std::vector<AtlasPage> m_atlasPages;
+        static bool m_atlasEnabled;
+        static bool m_alphaMaskEnabled;
+        static bool m_asyncLoadingEnabled;
+        static std::size_t m_loadingImageCount;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
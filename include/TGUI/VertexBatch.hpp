@@ -0,0 +1,182 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_VERTEX_BATCH_HPP
+#define TGUI_VERTEX_BATCH_HPP
+
+#include <TGUI/Global.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Collects the geometry of widgets in a single vertex buffer to reduce the amount of draw calls
+    ///
+    /// While a batch is active, triangles that are drawn via this class are transformed on the CPU and appended to a buffer.
+    /// The buffer is only drawn when the texture, shader or blend mode changes, when something has to be drawn that can't be
+    /// batched or when the batch ends. When no batch is active, all functions in this class draw directly on the render target.
+    ///
+    /// Clipping doesn't interrupt the batch: the clipping areas are kept on a stack and the triangles are cut on the CPU to fit
+    /// inside the top area. Only things that can't be batched are drawn with a view that matches the clipping area.
+    ///
+    /// The gui starts a batch in its draw function when batched rendering was enabled with Gui::setBatchedRenderingEnabled.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API VertexBatch
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts collecting the geometry that is drawn on the given render target
+        ///
+        /// @param target  Render target on which the batch will be drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void begin(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the remaining geometry and stops batching
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void end();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether geometry drawn on the given target is currently being batched
+        ///
+        /// @param target  Render target to check
+        ///
+        /// @return True when a batch was started for this target and it is not paused, false otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isActive(const sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the geometry that was collected so far
+        ///
+        /// This function has to be called before drawing directly on the render target or changing its view while a batch is
+        /// active, otherwise the order in which things are drawn can't be guaranteed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void flush();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the collected geometry and temporarily draws everything directly on the render target
+        ///
+        /// Calls to pause and resume can be nested. This is used while drawing widgets that don't support batching.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void pause();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Continues collecting geometry after a call to pause
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resume();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds primitives to the batch or draws them directly when no batch is active
+        ///
+        /// Only triangles, triangle strips and triangle fans can be batched, other primitive types are always drawn directly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a shape to the batch or draws it directly when no batch is active
+        ///
+        /// Only untextured shapes without an outline can be batched, other shapes are always drawn directly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a drawable object directly on the render target after flushing the batch
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Restricts everything that is drawn on the batch to the given area, until popClipRect is called
+        ///
+        /// @param rect  Clipping area in the coordinates of the view of the render target
+        ///
+        /// The area is intersected with the previous clipping area, so nested areas can only make the visible region smaller.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void pushClipRect(const sf::FloatRect& rect);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Restores the clipping area that was active before the last call to pushClipRect
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void popClipRect();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of draw calls that were made since the batch was started
+        ///
+        /// @return Number of times that a draw function was called on the render target since the last call to begin
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int getDrawCallCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Flushes the buffer when the new geometry can't be drawn with the render states of the geometry that is already in it
+        static void prepare(const sf::RenderStates& states);
+
+        // Adds a single triangle that has already been transformed, the part outside the clipping area is cut off
+        static void addTriangle(const sf::Vertex& v1, const sf::Vertex& v2, const sf::Vertex& v3);
+
+        // Draws directly on the render target, with a view that only shows the current clipping area
+        template <typename Func>
+        static void drawUnbatched(sf::RenderTarget& target, const Func& func);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        static sf::RenderTarget* m_target;
+        static sf::RenderStates m_states;
+        static std::vector<sf::Vertex> m_vertices;
+        static std::vector<sf::Vertex> m_shapeVertices; // Reused when converting shapes to avoid an allocation per shape
+        static unsigned int m_pauseCount;
+        static unsigned int m_drawCallCount;
+        static std::vector<sf::FloatRect> m_clipRects;
+        static sf::View m_viewBeforePause;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_VERTEX_BATCH_HPP
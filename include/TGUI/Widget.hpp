@@ -46,6 +46,7 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 
 #include <unordered_set>
+#include <typeinfo>
 
 #ifdef TGUI_USE_CPP17
     #include <any>
@@ -424,6 +425,17 @@ namespace tgui
         virtual void moveToBack();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tells the gui that the area occupied by the widget has to be drawn again
+        ///
+        /// Widgets already call this function themselves when their state, text or renderer properties change. You only have to
+        /// call it when the appearance of the widget was changed in a way that the widget can't detect, e.g. after drawing on
+        /// the render texture of a canvas. It has no effect unless partial redrawing was enabled with Gui::setPartialRedrawEnabled
+        /// or when the widget is inside a container that caches its rendering.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Stores some data into the widget
         /// @param userData  Data to store
@@ -692,9 +704,9 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed, PropertyId::getName() returns its lowercase name
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual void rendererChanged(const std::string& property);
+        virtual void rendererChanged(PropertyId property);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -740,13 +752,27 @@ namespace tgui
                          Color color) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the widget can be drawn while a batch is active, which is only the case when m_batchableWidgetType
+        // was set by the class of the widget itself and not only by one of its base classes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isBatchableWidget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether mouseOnWidget can only return true inside the bounds of the widget, which is only the case when
+        // m_mouseOnWidgetInsideBoundsType was set by the class of the widget itself and not only by one of its base classes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isMouseOnWidgetInsideBounds() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Callback function which is called on a renderer change and which calls the virtual rendererChanged function
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChangedCallback(const std::string& property);
+        void rendererChangedCallback(PropertyId property);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -805,6 +831,15 @@ namespace tgui
         // This is set to true for widgets that store other widgets inside them
         bool m_containerWidget = false;
 
+        // Widgets that draw everything through the VertexBatch class store their own type here. Widgets derived from them may
+        // draw directly on the render target, so they are only batched when they store their own type as well.
+        const std::type_info* m_batchableWidgetType = nullptr;
+
+        // Widgets of which mouseOnWidget can only return true inside the rectangle formed by their position and size store
+        // their own type here, which allows the parent to store them in its spatial index. Derived widgets may override
+        // mouseOnWidget, so they are only stored in the index when they store their own type as well.
+        const std::type_info* m_mouseOnWidgetInsideBoundsType = nullptr;
+
         // The tool tip connected to the widget
         Widget::Ptr m_toolTip = nullptr;
 
@@ -828,7 +863,7 @@ namespace tgui
         tgui::Any m_userData;
     #endif
 
-        std::function<void(const std::string& property)> m_rendererChangedCallback = [this](const std::string& property){ rendererChangedCallback(property); };
+        std::function<void(PropertyId property)> m_rendererChangedCallback = [this](PropertyId property){ rendererChangedCallback(property); };
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -52,6 +52,7 @@ namespace tgui
         {
             Text text;
             sf::String string;
+            float top = 0; // Only differences between the tops of lines are meaningful, the first line doesn't start at 0
         };
 
 
@@ -137,6 +138,31 @@ namespace tgui
         void addLine(const sf::String& text, Color color);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple lines of text to the chat box at once
+        ///
+        /// This gives the same result as calling addLine for each line, but the scrollbar is only updated once and lines that
+        /// would immediately be removed again because of the line limit are skipped.
+        ///
+        /// The default text color will be used.
+        ///
+        /// @param lines  Texts that will be added to the chat box, each as a separate line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLines(const std::vector<sf::String>& lines);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple lines of text to the chat box at once
+        ///
+        /// This gives the same result as calling addLine for each line, but the scrollbar is only updated once and lines that
+        /// would immediately be removed again because of the line limit are skipped.
+        ///
+        /// @param lines  Texts that will be added to the chat box, each as a separate line
+        /// @param color  Color of the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLines(const std::vector<sf::String>& lines, Color color);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the contents of the requested line
         ///
@@ -329,6 +355,12 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a line without updating the scrollbar. When the line limit is reached, the oldest line is reused for the new text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertLine(const sf::String& text, Color color);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the text attribute of the line
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -341,6 +373,12 @@ namespace tgui
         void recalculateAllLines();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the vertical positions of the lines, starting from the line with the given index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateLineTops(std::size_t firstLineIndex);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the space used by all the lines
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -378,7 +416,7 @@ namespace tgui
         /// @param property  Lowercase name of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
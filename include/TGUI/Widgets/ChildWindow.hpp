@@ -392,6 +392,12 @@ namespace tgui
         void updateTitleBarHeight();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the parent that the title bar has to be drawn again, e.g. because the mouse is on top of one of its buttons.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateTitleBar();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves a signal based on its name
         ///
@@ -410,7 +416,7 @@ namespace tgui
         /// @param property  Lowercase name of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -175,6 +175,38 @@ namespace tgui
         bool addItem(const sf::String& itemName, const sf::String& id = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple items to the list at once
+        ///
+        /// @param itemNames  The names of the items you want to add
+        /// @param ids        Optional ids for the items. Items for which no id is given in this list will have an empty id.
+        ///
+        /// This is faster than calling addItem for every item, as the size of the list is only updated once after adding all items.
+        ///
+        /// @return Amount of items that were added, which is less than the size of itemNames when the maximum item limit is reached
+        ///
+        /// @see setMaximumItems
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t addItems(const std::vector<sf::String>& itemNames, const std::vector<sf::String>& ids = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces all items in the list with the given items
+        ///
+        /// @param itemNames  The names of the items that will be in the list
+        /// @param ids        Optional ids for the items. Items for which no id is given in this list will have an empty id.
+        ///
+        /// This is the same as calling removeAllItems followed by addItems.
+        ///
+        /// @return Amount of items in the list, which is less than the size of itemNames when the maximum item limit is reached
+        ///
+        /// @see setMaximumItems
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t setItems(const std::vector<sf::String>& itemNames, const std::vector<sf::String>& ids = {});
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Selects an item from the list
         ///
@@ -540,7 +572,7 @@ namespace tgui
         /// @param property  Lowercase name of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
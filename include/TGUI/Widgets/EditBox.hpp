@@ -30,6 +30,7 @@
 #include <TGUI/Renderers/EditBoxRenderer.hpp>
 #include <TGUI/FloatRect.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/GlyphMetrics.hpp>
 #include <regex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -461,7 +462,7 @@ namespace tgui
         /// @param property  Lowercase name of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -557,6 +558,11 @@ namespace tgui
         // The text inside the edit box
         sf::String    m_text;
 
+        // Offsets of the characters in m_text, to find the caret position with a binary search. They are cleared when the text
+        // changes and are recalculated when needed or when the metrics of the font differ from the ones they were calculated with.
+        std::vector<float> m_characterOffsets;
+        std::shared_ptr<GlyphMetrics> m_characterOffsetsMetrics;
+
         std::string   m_regexString = ".*";
         std::regex    m_regex = std::regex{m_regexString};
 
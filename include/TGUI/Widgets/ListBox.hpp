@@ -30,6 +30,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -125,6 +126,38 @@ namespace tgui
         bool addItem(const sf::String& itemName, const sf::String& id = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple items to the list at once
+        ///
+        /// @param itemNames  The names of the items you want to add
+        /// @param ids        Optional ids for the items. Items for which no id is given in this list will have an empty id.
+        ///
+        /// This is faster than calling addItem for every item, as the scrollbar is only updated once after adding all items.
+        ///
+        /// @return Amount of items that were added, which is less than the size of itemNames when the maximum item limit is reached
+        ///
+        /// @see setMaximumItems
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t addItems(const std::vector<sf::String>& itemNames, const std::vector<sf::String>& ids = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces all items in the list with the given items
+        ///
+        /// @param itemNames  The names of the items that will be in the list
+        /// @param ids        Optional ids for the items. Items for which no id is given in this list will have an empty id.
+        ///
+        /// This is the same as calling removeAllItems followed by addItems.
+        ///
+        /// @return Amount of items in the list, which is less than the size of itemNames when the maximum item limit is reached
+        ///
+        /// @see setMaximumItems
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t setItems(const std::vector<sf::String>& itemNames, const std::vector<sf::String>& ids = {});
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Selects an item in the list box
         ///
@@ -522,7 +555,7 @@ namespace tgui
         /// @param property  Lowercase name of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -544,15 +577,34 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update the colors and text style of the selected and hovered items
+        // Returns the index of the first item with the given text, or -1 when there is no such item
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateSelectedAndHoveringItemColorsAndStyle();
+        int findItemIndex(const sf::String& itemName) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update the color and text style of all the items
+        // Returns the index of the first item with the given id, or -1 when there is no such item
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateItemColorsAndStyle();
+        int findItemIdIndex(const sf::String& id) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rebuilds the maps that are used to find items by their text or id, if they are no longer up-to-date
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemIndices() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that there is a text object for every visible item. Texts of items that remain visible after scrolling are
+        // reused, the other ones are given the string of a newly visible item.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleItems(std::size_t firstItem, std::size_t lastItem) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gives the text of an item the color and text style that it should have, depending on whether it is selected or hovered
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemColorAndStyle(Text& text, std::size_t item) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -595,9 +647,27 @@ namespace tgui
     protected:
 
         // This contains the different items in the list box
-        std::vector<Text>       m_items;
+        std::vector<sf::String> m_items;
         std::vector<sf::String> m_itemIds;
 
+        // Text objects are only created for the items that are visible. When the list box is scrolled, the texts are recycled
+        // for the items that became visible. The texts are recreated from scratch when m_visibleItemsNeedUpdate is set.
+        mutable std::vector<Text> m_visibleItems;
+        mutable std::size_t m_visibleItemsStart = 0;
+        mutable bool m_visibleItemsNeedUpdate = true;
+
+        // Maps the texts and ids of the items to the first index where they occur, so that items can be found without searching
+        // the whole list. The maps are only created when an item is searched and they are rebuilt when an item was removed from
+        // the middle of the list, in which case m_itemIndicesValid is set to false.
+        struct ItemIndex
+        {
+            std::size_t firstIndex; // Index of the first item with this text or id
+            std::size_t count; // Amount of items with this text or id
+        };
+        mutable std::unordered_map<sf::String, ItemIndex, StringHash> m_itemIndices;
+        mutable std::unordered_map<sf::String, ItemIndex, StringHash> m_itemIdIndices;
+        mutable bool m_itemIndicesValid = false;
+
         // What is the index of the selected item?
         // This is also used by combo box, so it can't just be changed to a pointer!
         int m_selectedItem = -1;
@@ -148,6 +148,20 @@ namespace tgui
         bool addMenuItem(const sf::String& text);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple menu items at once
+        ///
+        /// @param menu   The name of the menu to which the menu items will be added
+        /// @param texts  The texts written on the new menu items
+        ///
+        /// This is faster than calling addMenuItem for every item, as the menu only has to be searched once.
+        ///
+        /// @return True when the items were added, false when menu was not found
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addMenuItems(const sf::String& menu, const std::vector<sf::String>& texts);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes a menu
         ///
@@ -294,6 +308,18 @@ namespace tgui
         void mouseLeftWidget() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The open menu is drawn outside the menu bar, so its area has to be passed to the parent separately when it changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateOpenMenu();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the text of a new menu item with the current font, color, opacity and text size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Text createMenuItem(const sf::String& text) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -325,7 +351,7 @@ namespace tgui
         /// @param property  Lowercase name of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -264,6 +264,13 @@ namespace tgui
         void mouseNoLongerDown() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // The child widgets are moved by the scrollbars before they are drawn, so the area is moved as well.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateChildRegion(FloatRect rect) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -282,7 +289,7 @@ namespace tgui
         /// @param property  Lowercase name of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -315,6 +322,12 @@ namespace tgui
         void updateScrollbars();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the parent that the scrollbars have to be drawn again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateScrollbars();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Find out what the most right and bottom positions are that are in use by the child widgets
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
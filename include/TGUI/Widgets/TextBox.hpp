@@ -360,12 +360,31 @@ namespace tgui
         void rearrangeText(bool keepSelection);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rearranges the text after removedCount characters at the given position were replaced by insertedCount characters.
+        // Only the paragraphs that contain the changed characters are word-wrapped again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rearrangeText(bool keepSelection, std::size_t changePosition, std::size_t removedCount, std::size_t insertedCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the line that contains the given position in the text (before the text was changed)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findLineOfTextPosition(std::size_t position) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function will split the text into five pieces so that the text can be easily drawn.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills the five pieces of text with the lines around the visible area.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateDisplayedTexts();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -421,7 +440,7 @@ namespace tgui
         /// @param property  Lowercase name of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -460,6 +479,9 @@ namespace tgui
 
         std::vector<sf::String> m_lines;
 
+        // Index in m_text of the first character of each line. The newline characters are not part of the lines.
+        std::vector<std::size_t> m_lineStartPositions;
+
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
 
@@ -467,6 +489,10 @@ namespace tgui
         std::size_t m_topLine = 1;
         std::size_t m_visibleLines = 1;
 
+        // Which lines are stored in the text pieces? Only the lines around the visible area are part of them.
+        std::size_t m_displayedLinesStart = 0;
+        std::size_t m_displayedLinesEnd = 0;
+
         // Information about the selection
         sf::Vector2<std::size_t> m_selStart;
         sf::Vector2<std::size_t> m_selEnd;
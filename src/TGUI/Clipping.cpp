@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Clipping.hpp>
+#include <TGUI/VertexBatch.hpp>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,6 +39,23 @@ namespace tgui
         m_target {target},
         m_oldView{target.getView()}
     {
+        // While batching, the clipping is done on the CPU so that the view doesn't have to change
+        if (VertexBatch::isActive(target))
+        {
+            const Vector2f transformedTopLeft = states.transform.transformPoint(topLeft);
+            const Vector2f transformedBottomRight = states.transform.transformPoint(topLeft + size);
+            const Vector2f roundedTopLeft = {std::round(transformedTopLeft.x), std::round(transformedTopLeft.y)};
+            VertexBatch::pushClipRect({roundedTopLeft.x,
+                                       roundedTopLeft.y,
+                                       std::round(transformedBottomRight.x) - roundedTopLeft.x,
+                                       std::round(transformedBottomRight.y) - roundedTopLeft.y});
+            m_batched = true;
+            return;
+        }
+
+        // Everything that was batched before the view changes has to be drawn with the old view
+        VertexBatch::flush();
+
         Vector2f bottomRight = Vector2f(states.transform.transformPoint(topLeft + size));
         topLeft = Vector2f(states.transform.transformPoint(topLeft));
 
@@ -97,6 +115,13 @@ namespace tgui
 
     Clipping::~Clipping()
     {
+        if (m_batched)
+        {
+            VertexBatch::popClipRect();
+            return;
+        }
+
+        VertexBatch::flush();
         m_target.setView(m_oldView);
     }
 
@@ -108,6 +133,13 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::View& Clipping::getGuiView()
+    {
+        return m_originalView;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
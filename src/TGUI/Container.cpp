@@ -25,10 +25,16 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/ToolTip.hpp>
+#include <TGUI/VertexBatch.hpp>
+#include <TGUI/Clipping.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 
+#include <SFML/Graphics/Sprite.hpp>
+
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <fstream>
 
 #ifdef SFML_SYSTEM_WINDOWS
@@ -45,6 +51,32 @@ namespace tgui
 
     namespace
     {
+        // Limits for the grid that is used to find the widget below the mouse when the spatial index is enabled
+        const float MinSpatialIndexCellSize = 8;
+        const float MaxSpatialIndexCellsPerWidget = 64;
+
+        // When more areas changed than this, a single area containing all of them is drawn instead
+        const std::size_t MaxDirtyRegions = 8;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        FloatRect getUnion(const FloatRect& rect1, const FloatRect& rect2)
+        {
+            const float left = std::min(rect1.left, rect2.left);
+            const float top = std::min(rect1.top, rect2.top);
+            return {left,
+                    top,
+                    std::max(rect1.left + rect1.width, rect2.left + rect2.width) - left,
+                    std::max(rect1.top + rect1.height, rect2.top + rect2.height) - top};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint64_t getSpatialIndexKey(int x, int y)
+        {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+        }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         std::string getWorkingDirectory()
@@ -167,7 +199,7 @@ namespace tgui
             for (const auto& pair : renderer->propertyValuePairs)
             {
                 // Skip "font = null"
-                if (pair.first == "font" && ObjectConverter{pair.second}.getString() == "null")
+                if (pair.first == Property::Font && ObjectConverter{pair.second}.getString() == "null")
                     continue;
 
                 sf::String value = ObjectConverter{pair.second}.getString();
@@ -190,11 +222,11 @@ namespace tgui
 
                     recursiveTryRemoveAbsolutePath(rendererRootNode, workingDirectory);
 
-                    rendererRootNode->name = pair.first;
+                    rendererRootNode->name = pair.first.getName();
                     node->children.push_back(std::move(rendererRootNode));
                 }
                 else
-                    node->propertyValuePairs[pair.first] = make_unique<DataIO::ValueNode>(value);
+                    node->propertyValuePairs[pair.first.getName()] = make_unique<DataIO::ValueNode>(value);
             }
 
             return node;
@@ -214,7 +246,9 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget                {other},
+        m_spatialIndexEnabled {other.m_spatialIndexEnabled},
+        m_cachedRendering     {other.m_cachedRendering}
     {
         // Copy all the widgets
         for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
@@ -229,12 +263,17 @@ namespace tgui
         m_widgetNames         {std::move(other.m_widgetNames)},
         m_widgetBelowMouse    {std::move(other.m_widgetBelowMouse)},
         m_focusedWidget       {std::move(other.m_focusedWidget)},
-        m_handingMouseReleased{std::move(other.m_handingMouseReleased)}
+        m_handingMouseReleased{std::move(other.m_handingMouseReleased)},
+        m_spatialIndexEnabled {std::move(other.m_spatialIndexEnabled)},
+        m_widgetNameIndexNeedsUpdate{true},
+        m_subtreeNameCounts   {std::move(other.m_subtreeNameCounts)},
+        m_cachedRendering     {std::move(other.m_cachedRendering)}
     {
         for (auto& widget : m_widgets)
             widget->setParent(this);
 
         other.m_widgets = {};
+        other.m_subtreeNameCounts = {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -255,10 +294,21 @@ namespace tgui
         // Make sure it is not the same widget
         if (this != &right)
         {
+            // The parent still stores this container afterwards, so it has to count the names of the copied widgets instead
+            Container* parent = m_parent;
+            for (const auto& pair : m_subtreeNameCounts)
+            {
+                if (parent)
+                    parent->changeSubtreeNameCount(pair.first, -static_cast<int>(pair.second));
+            }
+
             Widget::operator=(right);
 
             m_widgetBelowMouse = nullptr;
             m_focusedWidget = nullptr;
+            m_spatialIndexEnabled = right.m_spatialIndexEnabled;
+            m_cachedRendering = right.m_cachedRendering;
+            m_renderCacheNeedsUpdate = true;
 
             // Remove all the old widgets
             Container::removeAllWidgets();
@@ -269,6 +319,12 @@ namespace tgui
                 // Don't allow the 'add' function of a derived class to be called, since its members are not copied yet
                 Container::add(right.m_widgets[i]->clone(), right.m_widgetNames[i]);
             }
+
+            for (const auto& pair : m_subtreeNameCounts)
+            {
+                if (parent)
+                    parent->changeSubtreeNameCount(pair.first, static_cast<int>(pair.second));
+            }
         }
 
         return *this;
@@ -281,17 +337,38 @@ namespace tgui
         // Make sure it is not the same widget
         if (this != &right)
         {
+            // The parent still stores this container afterwards, so it has to count the names of the moved widgets instead
+            Container* parent = m_parent;
+            for (const auto& pair : m_subtreeNameCounts)
+            {
+                if (parent)
+                    parent->changeSubtreeNameCount(pair.first, -static_cast<int>(pair.second));
+            }
+
             Widget::operator=(std::move(right));
             m_widgets              = std::move(right.m_widgets);
             m_widgetNames          = std::move(right.m_widgetNames);
             m_widgetBelowMouse     = std::move(right.m_widgetBelowMouse);
             m_focusedWidget        = std::move(right.m_focusedWidget);
             m_handingMouseReleased = std::move(right.m_handingMouseReleased);
+            m_spatialIndexEnabled  = std::move(right.m_spatialIndexEnabled);
+            m_spatialIndexNeedsUpdate = true;
+            m_subtreeNameCounts    = std::move(right.m_subtreeNameCounts);
+            m_widgetNameIndexNeedsUpdate = true;
+            m_cachedRendering      = std::move(right.m_cachedRendering);
+            m_renderCacheNeedsUpdate = true;
 
             for (auto& widget : m_widgets)
                 widget->setParent(this);
 
             right.m_widgets = {};
+            right.m_subtreeNameCounts = {};
+
+            for (const auto& pair : m_subtreeNameCounts)
+            {
+                if (parent)
+                    parent->changeSubtreeNameCount(pair.first, static_cast<int>(pair.second));
+            }
         }
 
         return *this;
@@ -306,29 +383,67 @@ namespace tgui
         widgetPtr->setParent(this);
         m_widgets.push_back(widgetPtr);
         m_widgetNames.push_back(widgetName);
+        m_spatialIndexNeedsUpdate = true;
+
+        // The new widget is behind all existing widgets, so it is only found directly when no other widget has the same name
+        if (!m_widgetNameIndexNeedsUpdate)
+            m_widgetNameIndex.emplace(widgetName, m_widgets.size() - 1);
+
+        changeSubtreeNameCounts(widgetPtr, widgetName, 1);
 
         if (m_fontCached != getGlobalFont())
             widgetPtr->setInheritedFont(m_fontCached);
 
         if (m_opacityCached < 1)
             widgetPtr->setInheritedOpacity(m_opacityCached);
+
+        widgetPtr->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Container::get(const sf::String& widgetName) const
     {
-        for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
+        return getRecursive(widgetName);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Container::getDirect(const sf::String& widgetName) const
+    {
+        if (m_widgetNameIndexNeedsUpdate)
         {
-            if (m_widgetNames[i] == widgetName)
-                return m_widgets[i];
+            m_widgetNameIndex.clear();
+            for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
+                m_widgetNameIndex.emplace(m_widgetNames[i], i);
+
+            m_widgetNameIndexNeedsUpdate = false;
         }
 
-        for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
+        const auto it = m_widgetNameIndex.find(widgetName);
+        if (it != m_widgetNameIndex.end())
+            return m_widgets[it->second];
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Container::getRecursive(const sf::String& widgetName) const
+    {
+        // Don't search any further when there is no widget with this name inside this container
+        if (m_subtreeNameCounts.find(widgetName) == m_subtreeNameCounts.end())
+            return nullptr;
+
+        Widget::Ptr widget = getDirect(widgetName);
+        if (widget != nullptr)
+            return widget;
+
+        for (const auto& child : m_widgets)
         {
-            if (m_widgets[i]->isContainer())
+            if (child->isContainer())
             {
-                Widget::Ptr widget = std::static_pointer_cast<Container>(m_widgets[i])->get(widgetName);
+                widget = std::static_pointer_cast<Container>(child)->getRecursive(widgetName);
                 if (widget != nullptr)
                     return widget;
             }
@@ -356,10 +471,17 @@ namespace tgui
                 if (widget == m_focusedWidget)
                     unfocusWidgets();
 
+                // The area that the widget occupied has to be drawn again
+                widget->invalidate();
+
                 // Remove the widget
                 widget->setParent(nullptr);
+                changeSubtreeNameCounts(widget, m_widgetNames[i], -1);
+
                 m_widgets.erase(m_widgets.begin() + i);
                 m_widgetNames.erase(m_widgetNames.begin() + i);
+                m_spatialIndexNeedsUpdate = true;
+                m_widgetNameIndexNeedsUpdate = true;
                 return true;
             }
         }
@@ -372,10 +494,23 @@ namespace tgui
     void Container::removeAllWidgets()
     {
         for (const auto& widget : m_widgets)
+        {
+            widget->invalidate();
             widget->setParent(nullptr);
+        }
+
+        for (const auto& pair : m_subtreeNameCounts)
+        {
+            if (m_parent)
+                m_parent->changeSubtreeNameCount(pair.first, -static_cast<int>(pair.second));
+        }
 
         m_widgets.clear();
         m_widgetNames.clear();
+        m_spatialIndexNeedsUpdate = true;
+        m_widgetNameIndex.clear();
+        m_widgetNameIndexNeedsUpdate = false;
+        m_subtreeNameCounts.clear();
 
         m_widgetBelowMouse = nullptr;
         m_focusedWidget = nullptr;
@@ -389,7 +524,11 @@ namespace tgui
         {
             if (m_widgets[i] == widget)
             {
+                changeSubtreeNameCount(m_widgetNames[i], -1);
+                changeSubtreeNameCount(name, 1);
+
                 m_widgetNames[i] = name;
+                m_widgetNameIndexNeedsUpdate = true;
                 return true;
             }
         }
@@ -706,6 +845,10 @@ namespace tgui
             // Check if the widget is found
             if (m_widgets[i] == widget)
             {
+                // The widget will be drawn on top of the widgets that were in front of it
+                if (i + 1 < m_widgets.size())
+                    widget->invalidate();
+
                 // Copy the widget
                 m_widgets.push_back(m_widgets[i]);
                 m_widgetNames.push_back(m_widgetNames[i]);
@@ -713,6 +856,8 @@ namespace tgui
                 // Remove the old widget
                 m_widgets.erase(m_widgets.begin() + i);
                 m_widgetNames.erase(m_widgetNames.begin() + i);
+                m_spatialIndexNeedsUpdate = true;
+                m_widgetNameIndexNeedsUpdate = true;
 
                 break;
             }
@@ -729,6 +874,10 @@ namespace tgui
             // Check if the widget is found
             if (m_widgets[i] == widget)
             {
+                // The widgets that were behind the widget will now be drawn on top of it
+                if (i > 0)
+                    widget->invalidate();
+
                 // Copy the widget
                 const Widget::Ptr obj = m_widgets[i];
                 const std::string name = m_widgetNames[i];
@@ -738,6 +887,8 @@ namespace tgui
                 // Remove the old widget
                 m_widgets.erase(m_widgets.begin() + i + 1);
                 m_widgetNames.erase(m_widgetNames.begin() + i + 1);
+                m_spatialIndexNeedsUpdate = true;
+                m_widgetNameIndexNeedsUpdate = true;
 
                 break;
             }
@@ -746,6 +897,54 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setSpatialIndexEnabled(bool enabled)
+    {
+        m_spatialIndexEnabled = enabled;
+        m_spatialIndexNeedsUpdate = true;
+
+        if (!m_spatialIndexEnabled)
+        {
+            m_spatialIndexCells.clear();
+            m_spatialIndexUnindexedWidgets.clear();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isSpatialIndexEnabled() const
+    {
+        return m_spatialIndexEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setCachedRendering(bool cached)
+    {
+        m_cachedRendering = cached;
+        m_renderCacheNeedsUpdate = true;
+        m_renderCacheUpdateCount = 0;
+
+        // Release the memory of the texture when it is no longer needed
+        if (!m_cachedRendering)
+            m_renderCache = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::getCachedRendering() const
+    {
+        return m_cachedRendering;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Container::getCachedRenderingUpdateCount() const
+    {
+        return m_renderCacheUpdateCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::leftMousePressed(Vector2f pos)
     {
         sf::Event event;
@@ -858,6 +1057,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::invalidateChildRegion(FloatRect rect)
+    {
+        // The cached texture has to be updated even when the container is hidden, it will be used again when it is shown
+        m_renderCacheNeedsUpdate = true;
+
+        if (m_parent && m_visible)
+        {
+            const Vector2f offset = getPosition() + getChildWidgetsOffset();
+            m_parent->invalidateChildRegion({rect.left + offset.x, rect.top + offset.y, rect.width, rect.height});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr Container::askToolTip(Vector2f mousePos)
     {
         if (mouseOnWidget(mousePos))
@@ -883,21 +1096,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::rendererChanged(const std::string& property)
+    void Container::rendererChanged(PropertyId property)
     {
         Widget::rendererChanged(property);
 
-        if (property == "opacity")
-        {
-            for (std::size_t i = 0; i < m_widgets.size(); ++i)
-                m_widgets[i]->setInheritedOpacity(m_opacityCached);
-        }
-        else if (property == "font")
+        switch (property.getId())
         {
-            for (const auto& widget : m_widgets)
+            case Property::Opacity:
+            {
+                for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                    m_widgets[i]->setInheritedOpacity(m_opacityCached);
+                break;
+            }
+
+            case Property::Font:
             {
-                if (m_fontCached != getGlobalFont())
-                    widget->setInheritedFont(m_fontCached);
+                for (const auto& widget : m_widgets)
+                {
+                    if (m_fontCached != getGlobalFont())
+                        widget->setInheritedFont(m_fontCached);
+                }
+                break;
             }
         }
     }
@@ -980,6 +1199,9 @@ namespace tgui
                     // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
                     if (widget->m_draggableWidget || widget->isContainer())
                     {
+                        if (!widget->isContainer())
+                            widget->invalidate();
+
                         widget->mouseMoved(mousePos);
                         return true;
                     }
@@ -990,6 +1212,10 @@ namespace tgui
             Widget::Ptr widget = mouseOnWhichWidget(mousePos);
             if (widget != nullptr)
             {
+                // Containers invalidate the parts of them that change, for other widgets we don't know what will change
+                if (!widget->isContainer())
+                    widget->invalidate();
+
                 // Send the event to the widget
                 widget->mouseMoved(mousePos);
                 return true;
@@ -1025,6 +1251,9 @@ namespace tgui
                     }
                 }
 
+                if (!widget->isContainer())
+                    widget->invalidate();
+
                 if (((event.type == sf::Event::MouseButtonPressed) && (event.mouseButton.button == sf::Mouse::Left))
                  || ((event.type == sf::Event::TouchBegan) && (event.touch.finger == 0)))
                 {
@@ -1056,7 +1285,12 @@ namespace tgui
             // Check if the mouse is on top of a widget
             Widget::Ptr widgetBelowMouse = mouseOnWhichWidget(mousePos);
             if (widgetBelowMouse != nullptr)
+            {
+                if (!widgetBelowMouse->isContainer())
+                    widgetBelowMouse->invalidate();
+
                 widgetBelowMouse->leftMouseReleased(mousePos);
+            }
 
             // Tell all widgets that the mouse has gone up
             // But don't do this when leftMouseReleased was called on this container because
@@ -1089,6 +1323,9 @@ namespace tgui
                 #endif
 
                     // Tell the widget that the key was pressed
+                    if (!m_focusedWidget->isContainer())
+                        m_focusedWidget->invalidate();
+
                     m_focusedWidget->keyPressed(event.key);
                     return true;
                 }
@@ -1121,6 +1358,9 @@ namespace tgui
                 // Tell the widget that the key was pressed
                 if (m_focusedWidget)
                 {
+                    if (!m_focusedWidget->isContainer())
+                        m_focusedWidget->invalidate();
+
                     m_focusedWidget->textEntered(event.text.unicode);
                     return true;
                 }
@@ -1136,6 +1376,9 @@ namespace tgui
             Widget::Ptr widget = mouseOnWhichWidget({static_cast<float>(event.mouseWheelScroll.x), static_cast<float>(event.mouseWheelScroll.y)});
             if (widget != nullptr)
             {
+                if (!widget->isContainer())
+                    widget->invalidate();
+
                 // Send the event to the widget
                 widget->mouseWheelScrolled(event.mouseWheelScroll.delta, {static_cast<float>(event.mouseWheelScroll.x), static_cast<float>(event.mouseWheelScroll.y)});
                 return true;
@@ -1407,16 +1650,54 @@ namespace tgui
     Widget::Ptr Container::mouseOnWhichWidget(Vector2f mousePos)
     {
         Widget::Ptr widget = nullptr;
-        for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
+        if (m_spatialIndexEnabled)
+        {
+            if (m_spatialIndexNeedsUpdate || (m_spatialIndexWidgetCount != m_widgets.size()))
+                updateSpatialIndex();
+
+            // Only the widgets in the cell below the mouse and the widgets that aren't in the grid have to be checked.
+            // Both lists are sorted, so they are merged to check the widgets from front to back like below.
+            static const std::vector<std::size_t> emptyCell;
+            const auto cellIt = m_spatialIndexCells.find(getSpatialIndexKey(static_cast<int>(std::floor(mousePos.x / m_spatialIndexCellSize)),
+                                                                             static_cast<int>(std::floor(mousePos.y / m_spatialIndexCellSize))));
+            const std::vector<std::size_t>& cell = (cellIt != m_spatialIndexCells.end()) ? cellIt->second : emptyCell;
+            const std::vector<std::size_t>& unindexed = m_spatialIndexUnindexedWidgets;
+
+            std::size_t cellPos = cell.size();
+            std::size_t unindexedPos = unindexed.size();
+            while ((cellPos > 0) || (unindexedPos > 0))
+            {
+                std::size_t index;
+                if ((unindexedPos == 0) || ((cellPos > 0) && (cell[cellPos - 1] > unindexed[unindexedPos - 1])))
+                    index = cell[--cellPos];
+                else
+                    index = unindexed[--unindexedPos];
+
+                if (m_widgets[index]->isVisible())
+                {
+                    if (m_widgets[index]->mouseOnWidget(mousePos))
+                    {
+                        if (m_widgets[index]->isEnabled())
+                            widget = m_widgets[index];
+
+                        break;
+                    }
+                }
+            }
+        }
+        else
         {
-            if ((*it)->isVisible())
+            for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
             {
-                if ((*it)->mouseOnWidget(mousePos))
+                if ((*it)->isVisible())
                 {
-                    if ((*it)->isEnabled())
-                        widget = *it;
+                    if ((*it)->mouseOnWidget(mousePos))
+                    {
+                        if ((*it)->isEnabled())
+                            widget = *it;
 
-                    break;
+                        break;
+                    }
                 }
             }
         }
@@ -1431,14 +1712,177 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::updateSpatialIndex()
+    {
+        m_spatialIndexNeedsUpdate = false;
+        m_spatialIndexWidgetCount = m_widgets.size();
+        m_spatialIndexCells.clear();
+        m_spatialIndexUnindexedWidgets.clear();
+
+        // The cells are made as large as the average widget, so that most widgets only overlap a few cells
+        float totalSize = 0;
+        std::size_t count = 0;
+        for (const auto& widget : m_widgets)
+        {
+            if (widget->isMouseOnWidgetInsideBounds())
+            {
+                totalSize += std::max(std::abs(widget->getSize().x), std::abs(widget->getSize().y));
+                count++;
+            }
+        }
+
+        m_spatialIndexCellSize = (count > 0) ? std::max(totalSize / count, MinSpatialIndexCellSize) : MinSpatialIndexCellSize;
+
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            const auto& widget = m_widgets[i];
+            if (!widget->isMouseOnWidgetInsideBounds())
+            {
+                m_spatialIndexUnindexedWidgets.push_back(i);
+                continue;
+            }
+
+            // The size can be negative, in which case the widget lies on the other side of its position
+            const Vector2f position = widget->getPosition();
+            const Vector2f size = widget->getSize();
+            const float left = std::floor(std::min(position.x, position.x + size.x) / m_spatialIndexCellSize);
+            const float top = std::floor(std::min(position.y, position.y + size.y) / m_spatialIndexCellSize);
+            const float right = std::floor(std::max(position.x, position.x + size.x) / m_spatialIndexCellSize);
+            const float bottom = std::floor(std::max(position.y, position.y + size.y) / m_spatialIndexCellSize);
+
+            // Very large widgets would fill too many cells, they are checked for every mouse event instead
+            if ((right - left + 1) * (bottom - top + 1) > MaxSpatialIndexCellsPerWidget)
+            {
+                m_spatialIndexUnindexedWidgets.push_back(i);
+                continue;
+            }
+
+            for (int x = static_cast<int>(left); x <= static_cast<int>(right); ++x)
+            {
+                for (int y = static_cast<int>(top); y <= static_cast<int>(bottom); ++y)
+                    m_spatialIndexCells[getSpatialIndexKey(x, y)].push_back(i);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::changeSubtreeNameCount(const sf::String& widgetName, int change)
+    {
+        for (Container* container = this; container != nullptr; container = container->m_parent)
+        {
+            auto& count = container->m_subtreeNameCounts[widgetName];
+            count = static_cast<unsigned int>(static_cast<int>(count) + change);
+            if (count == 0)
+                container->m_subtreeNameCounts.erase(widgetName);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::changeSubtreeNameCounts(const Widget::Ptr& widget, const sf::String& widgetName, int change)
+    {
+        changeSubtreeNameCount(widgetName, change);
+
+        if (widget->isContainer())
+        {
+            for (const auto& pair : std::static_pointer_cast<Container>(widget)->m_subtreeNameCounts)
+                changeSubtreeNameCount(pair.first, change * static_cast<int>(pair.second));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
+    {
+        if (m_cachedRendering && updateRenderCache())
+        {
+            // The colors on the texture were already multiplied with their alpha value when the widgets were drawn on it
+            sf::RenderStates cacheStates = states;
+            cacheStates.blendMode = sf::BlendMode{sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha};
+            VertexBatch::draw(*target, sf::Sprite{m_renderCache->getTexture()}, cacheStates);
+        }
+        else
+            drawChildWidgets(*target, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::drawChildWidgets(sf::RenderTarget& target, const sf::RenderStates& states, const FloatRect* visibleArea) const
     {
         // Draw all widgets when they are visible
         for (const auto& widget : m_widgets)
         {
-            if (widget->isVisible())
-                widget->draw(*target, states);
+            if (!widget->isVisible())
+                continue;
+
+            if (visibleArea && !visibleArea->intersects({widget->getPosition() + widget->getWidgetOffset(), widget->getFullSize()}))
+                continue;
+
+            // Widgets that may draw directly on the target can't be part of a batch
+            if (widget->isBatchableWidget())
+                widget->draw(target, states);
+            else
+            {
+                VertexBatch::pause();
+                widget->draw(target, states);
+                VertexBatch::resume();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::updateRenderCache() const
+    {
+        if (m_renderCache && !m_renderCacheNeedsUpdate)
+            return true;
+
+        // The texture has to be large enough to contain all child widgets
+        Vector2f bottomRight;
+        for (const auto& widget : m_widgets)
+        {
+            if (!widget->isVisible())
+                continue;
+
+            const Vector2f widgetBottomRight = widget->getPosition() + widget->getWidgetOffset() + widget->getFullSize();
+            bottomRight.x = std::max(bottomRight.x, widgetBottomRight.x);
+            bottomRight.y = std::max(bottomRight.y, widgetBottomRight.y);
         }
+
+        const sf::Vector2u size{std::max(1u, static_cast<unsigned int>(std::ceil(bottomRight.x))),
+                                std::max(1u, static_cast<unsigned int>(std::ceil(bottomRight.y)))};
+        if ((size.x > sf::Texture::getMaximumSize()) || (size.y > sf::Texture::getMaximumSize()))
+        {
+            m_renderCache = nullptr;
+            return false;
+        }
+
+        if (!m_renderCache || (m_renderCache->getSize() != size))
+        {
+            m_renderCache = make_unique<sf::RenderTexture>();
+            if (!m_renderCache->create(size.x, size.y))
+            {
+                m_renderCache = nullptr;
+                return false;
+            }
+        }
+
+        // Clipping inside the child widgets has to be calculated relative to the texture instead of the gui view
+        const sf::View cacheView{FloatRect{0, 0, static_cast<float>(size.x), static_cast<float>(size.y)}};
+        const sf::View guiView = Clipping::getGuiView();
+        Clipping::setGuiView(cacheView);
+
+        m_renderCache->setView(cacheView);
+        m_renderCache->clear(sf::Color::Transparent);
+        drawChildWidgets(*m_renderCache, sf::RenderStates::Default);
+        m_renderCache->display();
+
+        Clipping::setGuiView(guiView);
+
+        m_renderCacheNeedsUpdate = false;
+        ++m_renderCacheUpdateCount;
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1477,6 +1921,61 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void GuiContainer::invalidateChildRegion(FloatRect rect)
+    {
+        if (!m_dirtyRegionTrackingEnabled || (rect.width <= 0) || (rect.height <= 0))
+            return;
+
+        // Don't store the same area twice when a widget is invalidated multiple times in the same frame
+        for (const auto& region : m_dirtyRegions)
+        {
+            if ((rect.left >= region.left) && (rect.top >= region.top)
+             && (rect.left + rect.width <= region.left + region.width) && (rect.top + rect.height <= region.top + region.height))
+                return;
+        }
+
+        m_dirtyRegions.push_back(rect);
+
+        // Keep the list short when many widgets change before the gui is drawn again
+        if (m_dirtyRegions.size() > MaxDirtyRegions)
+            mergeDirtyRegions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::mergeDirtyRegions()
+    {
+        // Combine overlapping areas so that no part of the texture has to be drawn twice
+        bool merged = true;
+        while (merged)
+        {
+            merged = false;
+            for (std::size_t i = 0; (i < m_dirtyRegions.size()) && !merged; ++i)
+            {
+                for (std::size_t j = i + 1; j < m_dirtyRegions.size(); ++j)
+                {
+                    if (m_dirtyRegions[i].intersects(m_dirtyRegions[j]))
+                    {
+                        m_dirtyRegions[i] = getUnion(m_dirtyRegions[i], m_dirtyRegions[j]);
+                        m_dirtyRegions.erase(m_dirtyRegions.begin() + j);
+                        merged = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (m_dirtyRegions.size() > MaxDirtyRegions)
+        {
+            for (std::size_t i = 1; i < m_dirtyRegions.size(); ++i)
+                m_dirtyRegions[0] = getUnion(m_dirtyRegions[0], m_dirtyRegions[i]);
+
+            m_dirtyRegions.resize(1);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::draw(sf::RenderTarget&, sf::RenderStates) const
     {
     }
@@ -234,6 +234,18 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t StringHash::operator()(const sf::String& str) const
+    {
+        // Combine the hashes of the characters, the same way as boost::hash_combine does
+        std::size_t hash = str.getSize();
+        for (const auto c : str)
+            hash ^= std::hash<sf::Uint32>{}(c) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,145 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/GlyphMetrics.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    std::map<std::tuple<const sf::Font*, unsigned int, bool>, std::shared_ptr<GlyphMetrics>> GlyphMetrics::m_sharedMetrics;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    GlyphMetrics::GlyphMetrics(const std::shared_ptr<sf::Font>& font, unsigned int characterSize, bool bold) :
+        m_font         {font},
+        m_characterSize{characterSize},
+        m_bold         {bold}
+    {
+        m_latinAdvances.fill(-1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<GlyphMetrics> GlyphMetrics::get(const std::shared_ptr<sf::Font>& font, unsigned int characterSize, bool bold)
+    {
+        if (!font)
+            return nullptr;
+
+        // The metrics can only be reused when they were created for this font and not for an older one at the same address
+        const auto key = std::make_tuple(font.get(), characterSize, bold);
+        auto it = m_sharedMetrics.find(key);
+        if ((it != m_sharedMetrics.end()) && (it->second->m_font.lock() == font))
+            return it->second;
+
+        // Forget the metrics of fonts that no longer exist before adding new ones
+        for (auto metricsIt = m_sharedMetrics.begin(); metricsIt != m_sharedMetrics.end();)
+        {
+            if (metricsIt->second->m_font.expired())
+                metricsIt = m_sharedMetrics.erase(metricsIt);
+            else
+                ++metricsIt;
+        }
+
+        auto metrics = std::make_shared<GlyphMetrics>(font, characterSize, bold);
+        m_sharedMetrics[key] = metrics;
+        return metrics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float GlyphMetrics::getAdvance(std::uint32_t codePoint)
+    {
+        if (codePoint == '\t')
+            return getAdvance(' ') * 4;
+
+        if (codePoint < m_latinAdvances.size())
+        {
+            float& advance = m_latinAdvances[codePoint];
+            if (advance < 0)
+            {
+                const auto font = m_font.lock();
+                advance = font ? static_cast<float>(font->getGlyph(codePoint, m_characterSize, m_bold).advance) : 0;
+            }
+
+            return advance;
+        }
+
+        const auto it = m_advances.find(codePoint);
+        if (it != m_advances.end())
+            return it->second;
+
+        const auto font = m_font.lock();
+        const float advance = font ? static_cast<float>(font->getGlyph(codePoint, m_characterSize, m_bold).advance) : 0;
+        m_advances[codePoint] = advance;
+        return advance;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float GlyphMetrics::getKerning(std::uint32_t first, std::uint32_t second)
+    {
+        if ((first == 0) || (second == 0))
+            return 0;
+
+        const std::uint64_t key = (static_cast<std::uint64_t>(first) << 32) | second;
+        const auto it = m_kernings.find(key);
+        if (it != m_kernings.end())
+            return it->second;
+
+        const auto font = m_font.lock();
+        const float kerning = font ? static_cast<float>(font->getKerning(first, second, m_characterSize)) : 0;
+        m_kernings[key] = kerning;
+        return kerning;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphMetrics::getCharacterOffsets(const sf::String& text, std::vector<float>& offsets)
+    {
+        offsets.resize(text.getSize() + 1);
+        offsets[0] = 0;
+
+        // The width is summed in double precision and restarts on every line, so that long texts don't lose precision
+        double width = 0;
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < text.getSize(); ++i)
+        {
+            const std::uint32_t curChar = text[i];
+            if (curChar != '\n')
+                width += getAdvance(curChar) + getKerning(prevChar, curChar);
+            else
+                width = 0;
+
+            offsets[i + 1] = static_cast<float>(width);
+            prevChar = curChar;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,10 +26,19 @@
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/LayoutSolver.hpp>
+#include <TGUI/VertexBatch.hpp>
+#include <TGUI/TextureManager.hpp>
 
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/System/Err.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <map>
 
 #ifdef SFML_SYSTEM_WINDOWS
     #define NOMB
@@ -45,6 +54,70 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        // Informs the widgets that are subscribed to the renderer about the textures that were created since the last frame.
+        // A property containing a nested renderer counts as changed when a texture inside the nested renderer was changed.
+        bool notifyLoadedTextures(RendererData& data, const std::vector<std::shared_ptr<TextureData>>& loadedTextures,
+                                  std::map<const RendererData*, bool>& visitedRenderers)
+        {
+            const auto visitedIt = visitedRenderers.find(&data);
+            if (visitedIt != visitedRenderers.end())
+                return visitedIt->second;
+
+            visitedRenderers[&data] = false;
+
+            std::vector<PropertyId> changedProperties;
+            for (auto& pair : data.propertyValuePairs)
+            {
+                if (pair.second.getType() == ObjectConverter::Type::Texture)
+                {
+                    const auto& textureData = pair.second.getTexture().getData();
+                    if (textureData && (std::find(loadedTextures.begin(), loadedTextures.end(), textureData) != loadedTextures.end()))
+                        changedProperties.push_back(pair.first);
+                }
+                else if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                {
+                    const auto& nestedData = pair.second.getRenderer();
+                    if (nestedData && notifyLoadedTextures(*nestedData, loadedTextures, visitedRenderers))
+                        changedProperties.push_back(pair.first);
+                }
+            }
+
+            // The observers are copied because widgets may change the subscriptions while handling the change
+            const auto observers = data.observers;
+            for (const auto& property : changedProperties)
+            {
+                for (const auto& observer : observers)
+                    observer.second(property);
+            }
+
+            visitedRenderers[&data] = !changedProperties.empty();
+            return !changedProperties.empty();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void notifyLoadedTextures(const std::vector<Widget::Ptr>& widgets, const std::vector<std::shared_ptr<TextureData>>& loadedTextures,
+                                  std::map<const RendererData*, bool>& visitedRenderers)
+        {
+            for (const auto& widget : widgets)
+            {
+                notifyLoadedTextures(*widget->getSharedRenderer()->getData(), loadedTextures, visitedRenderers);
+
+                const auto container = std::dynamic_pointer_cast<Container>(widget);
+                if (container)
+                {
+                    // The list is copied because widgets could be added or removed while handling the change
+                    const std::vector<Widget::Ptr> childWidgets = container->getWidgets();
+                    notifyLoadedTextures(childWidgets, loadedTextures, visitedRenderers);
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Gui::Gui() :
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
         m_target(nullptr)
@@ -144,6 +217,7 @@ namespace tgui
             m_view = view;
 
         Clipping::setGuiView(m_view);
+        m_fullRedrawNeeded = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -159,6 +233,96 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
+        if (m_eventQueueEnabled)
+        {
+            queueEvent(event);
+            return false;
+        }
+
+        return dispatchEvent(event);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setEventQueueEnabled(bool enabled)
+    {
+        m_eventQueueEnabled = enabled;
+
+        if (!m_eventQueueEnabled && !m_eventQueue.empty())
+            processEventQueue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isEventQueueEnabled() const
+    {
+        return m_eventQueueEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::processEventQueue()
+    {
+        // Events can't be processed when this function is called from inside a widget while processing them
+        if (!m_eventsBeingProcessed.empty())
+            return;
+
+        // The queue is swapped with a second buffer in case a widget calls handleEvent while the events are being processed
+        m_eventsBeingProcessed.swap(m_eventQueue);
+        for (const auto& event : m_eventsBeingProcessed)
+            dispatchEvent(event);
+
+        m_eventsBeingProcessed.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Gui::getQueuedEventCount() const
+    {
+        return m_eventQueue.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Gui::getCoalescedEventCount() const
+    {
+        return m_coalescedEventCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::queueEvent(const sf::Event& event)
+    {
+        if (((event.type == sf::Event::MouseButtonPressed) && (event.mouseButton.button == sf::Mouse::Left))
+         || ((event.type == sf::Event::TouchBegan) && (event.touch.finger == 0)))
+            m_mouseDownInEventQueue = true;
+        else if (((event.type == sf::Event::MouseButtonReleased) && (event.mouseButton.button == sf::Mouse::Left))
+              || ((event.type == sf::Event::TouchEnded) && (event.touch.finger == 0)))
+            m_mouseDownInEventQueue = false;
+
+        // Only the last position matters when nothing is being dragged
+        if (!m_mouseDownInEventQueue && !m_eventQueue.empty() && (m_eventQueue.back().type == event.type))
+        {
+            if ((event.type == sf::Event::MouseMoved)
+             || ((event.type == sf::Event::TouchMoved) && (event.touch.finger == m_eventQueue.back().touch.finger)))
+            {
+                m_eventQueue.back() = event;
+                m_coalescedEventCount++;
+                return;
+            }
+        }
+
+        m_eventQueue.push_back(event);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::dispatchEvent(sf::Event event)
+    {
+        // Widgets must be at their correct position before finding out which one is below the mouse
+        if (LayoutSolver::getPendingCount() > 0)
+            LayoutSolver::flush();
+
         // Check if the event has something to do with the mouse
         if ((event.type == sf::Event::MouseMoved) || (event.type == sf::Event::TouchMoved)
          || (event.type == sf::Event::MouseButtonPressed) || (event.type == sf::Event::TouchBegan)
@@ -248,18 +412,56 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
+        // Pass the events that were received since the last frame to the widgets
+        if (!m_eventQueue.empty())
+            processEventQueue();
+
         // Update the time
         if (m_container->m_focused)
             updateTime(m_clock.restart());
         else
             m_clock.restart();
 
+        // Create the textures of images that were loaded on worker threads, without spending too much time on it in one frame
+        if (TextureManager::getLoadingImageCount() > 0)
+        {
+            m_texturesLoading = true;
+
+            std::vector<std::shared_ptr<TextureData>> loadedTextures;
+            TextureManager::processLoadedImages(m_textureUploadBudget, &loadedTextures);
+
+            // Widgets were drawn without the images while they were loading and may have to recalculate sizes based on them
+            if (!loadedTextures.empty())
+            {
+                std::map<const RendererData*, bool> visitedRenderers;
+                notifyLoadedTextures({m_container}, loadedTextures, visitedRenderers);
+            }
+
+            // We don't know which widgets use the new textures
+            m_fullRedrawNeeded = true;
+        }
+
+        if (m_texturesLoading && (TextureManager::getLoadingImageCount() == 0))
+        {
+            m_texturesLoading = false;
+            onTexturesLoaded.emit(m_container.get());
+        }
+
+        // Update the widgets of which the layouts changed since the last frame
+        if (LayoutSolver::getPendingCount() > 0)
+            LayoutSolver::flush();
+
         // Change the view
         const sf::View oldView = m_target->getView();
-        m_target->setView(m_view);
 
         // Draw the widgets
-        m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+        if (m_partialRedraw)
+            drawPartially();
+        else
+        {
+            m_target->setView(m_view);
+            drawWidgets(*m_target);
+        }
 
         // Restore the old view
         m_target->setView(oldView);
@@ -267,6 +469,63 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::setBatchedRenderingEnabled(bool enabled)
+    {
+        m_batchedRendering = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isBatchedRenderingEnabled() const
+    {
+        return m_batchedRendering;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setPartialRedrawEnabled(bool enabled)
+    {
+        m_partialRedraw = enabled;
+        m_fullRedrawNeeded = true;
+
+        m_container->m_dirtyRegionTrackingEnabled = enabled;
+        m_container->m_dirtyRegions.clear();
+
+        // Release the memory of the texture when it is no longer needed
+        if (!enabled)
+            m_cacheTexture = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isPartialRedrawEnabled() const
+    {
+        return m_partialRedraw;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<FloatRect>& Gui::getDirtyRegions() const
+    {
+        return m_container->m_dirtyRegions;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setTextureUploadBudget(sf::Time budget)
+    {
+        m_textureUploadBudget = budget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Gui::getTextureUploadBudget() const
+    {
+        return m_textureUploadBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     GuiContainer::Ptr Gui::getContainer() const
     {
         return m_container;
@@ -316,6 +575,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget::Ptr Gui::getDirect(const sf::String& widgetName) const
+    {
+        return m_container->getDirect(widgetName);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Gui::getRecursive(const sf::String& widgetName) const
+    {
+        return m_container->getRecursive(widgetName);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Gui::remove(const Widget::Ptr& widget)
     {
         return m_container->remove(widget);
@@ -465,6 +738,109 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::drawWidgets(sf::RenderTarget& target, const FloatRect* visibleArea)
+    {
+        if (m_batchedRendering)
+            VertexBatch::begin(target);
+
+        if (visibleArea)
+            m_container->drawChildWidgets(target, sf::RenderStates::Default, visibleArea);
+        else
+            m_container->drawWidgetContainer(&target, sf::RenderStates::Default);
+
+        if (m_batchedRendering)
+            VertexBatch::end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::drawPartially()
+    {
+        const sf::Vector2u targetSize = m_target->getSize();
+        if (!m_cacheTexture || (m_cacheTexture->getSize() != targetSize))
+        {
+            m_cacheTexture = make_unique<sf::RenderTexture>();
+            if (!m_cacheTexture->create(targetSize.x, targetSize.y))
+            {
+                TGUI_PRINT_WARNING("Failed to create texture for partial redrawing, drawing directly on the target instead.");
+                setPartialRedrawEnabled(false);
+
+                m_target->setView(m_view);
+                drawWidgets(*m_target);
+                return;
+            }
+
+            m_fullRedrawNeeded = true;
+        }
+
+        // The areas can only be drawn separately when they are rectangles on the texture
+        if (m_view.getRotation() != 0)
+            m_fullRedrawNeeded = true;
+
+        std::vector<FloatRect>& regions = m_container->m_dirtyRegions;
+        if (m_fullRedrawNeeded)
+        {
+            m_cacheTexture->setView(m_view);
+            m_cacheTexture->clear(sf::Color::Transparent);
+            drawWidgets(*m_cacheTexture);
+            m_cacheTexture->display();
+        }
+        else if (!regions.empty())
+        {
+            m_container->mergeDirtyRegions();
+
+            const Vector2f textureSize{static_cast<float>(targetSize.x), static_cast<float>(targetSize.y)};
+            const sf::FloatRect& viewport = m_view.getViewport();
+            const Vector2f viewTopLeft = m_view.getCenter() - (m_view.getSize() / 2.f);
+            const Vector2f scale{viewport.width * textureSize.x / m_view.getSize().x, viewport.height * textureSize.y / m_view.getSize().y};
+
+            for (const auto& region : regions)
+            {
+                // Find the pixels on which the area is drawn, with an extra pixel on each side for anti-aliasing
+                const float left = std::max(viewport.left * textureSize.x,
+                                            std::floor((region.left - viewTopLeft.x) * scale.x + (viewport.left * textureSize.x)) - 1);
+                const float top = std::max(viewport.top * textureSize.y,
+                                           std::floor((region.top - viewTopLeft.y) * scale.y + (viewport.top * textureSize.y)) - 1);
+                const float right = std::min((viewport.left + viewport.width) * textureSize.x,
+                                             std::ceil((region.left + region.width - viewTopLeft.x) * scale.x + (viewport.left * textureSize.x)) + 1);
+                const float bottom = std::min((viewport.top + viewport.height) * textureSize.y,
+                                              std::ceil((region.top + region.height - viewTopLeft.y) * scale.y + (viewport.top * textureSize.y)) + 1);
+                if ((right <= left) || (bottom <= top))
+                    continue;
+
+                // Use a view that shows the same part of the gui as the main view does on these pixels, but nothing else
+                sf::View view{{viewTopLeft.x + ((left - (viewport.left * textureSize.x)) / scale.x),
+                               viewTopLeft.y + ((top - (viewport.top * textureSize.y)) / scale.y),
+                               (right - left) / scale.x,
+                               (bottom - top) / scale.y}};
+                view.setViewport({left / textureSize.x, top / textureSize.y, (right - left) / textureSize.x, (bottom - top) / textureSize.y});
+                m_cacheTexture->setView(view);
+
+                // Erase the old contents of the area
+                sf::RectangleShape eraser{view.getSize()};
+                eraser.setPosition(view.getCenter() - (view.getSize() / 2.f));
+                eraser.setFillColor(sf::Color::Transparent);
+                m_cacheTexture->draw(eraser, sf::RenderStates{sf::BlendNone});
+
+                // Widgets that lie completely outside the area don't have to be drawn
+                const FloatRect visibleArea{view.getCenter() - (view.getSize() / 2.f), view.getSize()};
+                drawWidgets(*m_cacheTexture, &visibleArea);
+            }
+
+            m_cacheTexture->display();
+        }
+
+        m_fullRedrawNeeded = false;
+        regions.clear();
+
+        // The colors on the texture were already multiplied with their alpha value when the widgets were drawn on it
+        m_target->setView(m_target->getDefaultView());
+        m_target->draw(sf::Sprite{m_cacheTexture->getTexture()},
+                       sf::RenderStates{sf::BlendMode{sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha}});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
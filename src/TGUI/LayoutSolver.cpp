@@ -0,0 +1,233 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/LayoutSolver.hpp>
+#include <TGUI/Layout.hpp>
+#include <TGUI/Widget.hpp>
+#include <TGUI/to_string.hpp>
+#include <SFML/System/Err.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        const unsigned int PositionDirty = 1;
+        const unsigned int SizeDirty = 2;
+
+        const unsigned int VisitInProgress = 1;
+        const unsigned int VisitDone = 2;
+
+        // When widgets are still dirty after this many passes then the layouts keep changing each other
+        const unsigned int MaxFlushPasses = 100;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool LayoutSolver::m_deferredUpdatesEnabled = false;
+    bool LayoutSolver::m_flushing = false;
+    unsigned int LayoutSolver::m_updateCount = 0;
+    std::unordered_map<Widget*, unsigned int> LayoutSolver::m_dirtyWidgets;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutSolver::setDeferredUpdatesEnabled(bool enabled)
+    {
+        m_deferredUpdatesEnabled = enabled;
+
+        if (!m_deferredUpdatesEnabled)
+            flush();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool LayoutSolver::isDeferredUpdatesEnabled()
+    {
+        return m_deferredUpdatesEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutSolver::flush()
+    {
+        // Widgets that become dirty while flushing are handled by the loop below
+        if (m_flushing)
+            return;
+
+        m_flushing = true;
+        m_updateCount = 0;
+
+        bool cycleFound = false;
+        unsigned int passes = 0;
+        while (!m_dirtyWidgets.empty())
+        {
+            if (passes++ == MaxFlushPasses)
+            {
+                TGUI_PRINT_WARNING("layouts were still changing after " + to_string(MaxFlushPasses) + " passes, remaining updates are discarded.");
+                m_dirtyWidgets.clear();
+                break;
+            }
+
+            std::vector<Widget*> order;
+            order.reserve(m_dirtyWidgets.size());
+
+            std::unordered_map<Widget*, unsigned int> visited;
+            for (const auto& pair : m_dirtyWidgets)
+            {
+                if (!sortWidget(pair.first, visited, order))
+                    cycleFound = true;
+            }
+
+            // Updating a widget can make widgets later in the order dirty again, those are still updated only once in this pass.
+            // The entry is looked up again because a widget could have been destroyed by a callback while updating the others.
+            for (auto* widget : order)
+            {
+                const auto it = m_dirtyWidgets.find(widget);
+                if (it == m_dirtyWidgets.end())
+                    continue;
+
+                const unsigned int flags = it->second;
+                m_dirtyWidgets.erase(it);
+
+                if (flags & SizeDirty)
+                {
+                    widget->setSize(widget->getSizeLayout());
+                    m_updateCount++;
+                }
+
+                if (flags & PositionDirty)
+                {
+                    widget->setPosition(widget->getPositionLayout());
+                    m_updateCount++;
+                }
+            }
+        }
+
+        if (cycleFound)
+        {
+            TGUI_PRINT_WARNING("cycle detected in the layouts of widgets, widgets in the cycle may not have their final position or size.");
+        }
+
+        m_flushing = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t LayoutSolver::getPendingCount()
+    {
+        return m_dirtyWidgets.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int LayoutSolver::getUpdateCount()
+    {
+        return m_updateCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutSolver::positionChanged(Widget* widget)
+    {
+        if (m_deferredUpdatesEnabled)
+            m_dirtyWidgets[widget] |= PositionDirty;
+        else
+            widget->setPosition(widget->getPositionLayout());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutSolver::sizeChanged(Widget* widget)
+    {
+        if (m_deferredUpdatesEnabled)
+            m_dirtyWidgets[widget] |= SizeDirty;
+        else
+            widget->setSize(widget->getSizeLayout());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutSolver::removeWidget(Widget* widget)
+    {
+        if (!m_dirtyWidgets.empty())
+            m_dirtyWidgets.erase(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void LayoutSolver::addDependencies(const Layout& layout, std::vector<Widget*>& dependencies)
+    {
+        if (layout.m_boundWidget)
+            dependencies.push_back(layout.m_boundWidget);
+
+        if (layout.m_leftOperand)
+        {
+            addDependencies(*layout.m_leftOperand, dependencies);
+            addDependencies(*layout.m_rightOperand, dependencies);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool LayoutSolver::sortWidget(Widget* widget, std::unordered_map<Widget*, unsigned int>& visited, std::vector<Widget*>& order)
+    {
+        const auto visitedIt = visited.find(widget);
+        if (visitedIt != visited.end())
+            return (visitedIt->second == VisitDone);
+
+        visited[widget] = VisitInProgress;
+
+        std::vector<Widget*> dependencies;
+        addDependencies(widget->getPositionLayout().x, dependencies);
+        addDependencies(widget->getPositionLayout().y, dependencies);
+        addDependencies(widget->getSizeLayout().x, dependencies);
+        addDependencies(widget->getSizeLayout().y, dependencies);
+
+        // The dependencies are also followed through widgets that aren't dirty, to find cycles that pass through them
+        bool acyclic = true;
+        for (auto* dependency : dependencies)
+        {
+            // A widget may have a position that depends on its own size
+            if (dependency == widget)
+                continue;
+
+            if (!sortWidget(dependency, visited, order))
+                acyclic = false;
+        }
+
+        visited[widget] = VisitDone;
+
+        if (m_dirtyWidgets.find(widget) != m_dirtyWidgets.end())
+            order.push_back(widget);
+
+        return acyclic;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -166,7 +166,7 @@ namespace tgui
                             + ", " + to_string(texture.getData()->rect.width) + ", " + to_string(texture.getData()->rect.height) + ")";
             }
 
-            if (texture.getMiddleRect() != sf::IntRect{0, 0, static_cast<int>(texture.getData()->texture.getSize().x), static_cast<int>(texture.getData()->texture.getSize().y)})
+            if (texture.getMiddleRect() != sf::IntRect{0, 0, static_cast<int>(texture.getImageSize().x), static_cast<int>(texture.getImageSize().y)})
             {
                 result += " Middle(" + to_string(texture.getMiddleRect().left) + ", " + to_string(texture.getMiddleRect().top)
                               + ", " + to_string(texture.getMiddleRect().width) + ", " + to_string(texture.getMiddleRect().height) + ")";
@@ -215,12 +215,12 @@ namespace tgui
                 {
                     std::stringstream ss{ObjectConverter{pair.second}.getString()};
                     node->children.push_back(DataIO::parse(ss));
-                    node->children.back()->name = pair.first;
+                    node->children.back()->name = pair.first.getName();
                 }
                 else
                 {
                     strValue = ObjectConverter{pair.second}.getString();
-                    node->propertyValuePairs[pair.first] = make_unique<DataIO::ValueNode>(strValue);
+                    node->propertyValuePairs[pair.first.getName()] = make_unique<DataIO::ValueNode>(strValue);
                 }
             }
 
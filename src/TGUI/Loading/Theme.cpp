@@ -253,9 +253,9 @@ namespace tgui
             auto& properties = m_themeLoader->load(m_primary, pair.first);
 
             // Update the property-value pairs of the renderer
-            renderer->propertyValuePairs = std::map<std::string, ObjectConverter>{};
+            renderer->propertyValuePairs = std::map<PropertyId, ObjectConverter>{};
             for (const auto& property : properties)
-                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
+                renderer->propertyValuePairs[PropertyId{property.first}] = ObjectConverter(property.second);
 
             // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value
             auto oldIt = oldData->propertyValuePairs.begin();
@@ -316,7 +316,7 @@ namespace tgui
         m_renderers[lowercaseSecondary] = RendererData::create();
         auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
         for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
+            m_renderers[lowercaseSecondary]->propertyValuePairs[PropertyId{property.first}] = ObjectConverter(property.second);
 
         return m_renderers[lowercaseSecondary];
     }
@@ -339,7 +339,7 @@ namespace tgui
 
         auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
         for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
+            m_renderers[lowercaseSecondary]->propertyValuePairs[PropertyId{property.first}] = ObjectConverter(property.second);
 
         return m_renderers[lowercaseSecondary];
     }
@@ -0,0 +1,99 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/PropertyId.hpp>
+#include <TGUI/Global.hpp>
+#include <unordered_map>
+#include <deque>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // The names are stored in a deque so that the references returned by getName stay valid when new names are added
+        struct PropertyTable
+        {
+            std::deque<std::string> names;
+            std::unordered_map<std::string, unsigned int> ids;
+        };
+
+        PropertyTable createPropertyTable()
+        {
+            PropertyTable table;
+            table.names.push_back("");
+        #define TGUI_PROPERTY_ID_NAME(NAME) table.names.push_back(toLower(#NAME));
+            TGUI_RENDERER_PROPERTIES(TGUI_PROPERTY_ID_NAME)
+        #undef TGUI_PROPERTY_ID_NAME
+
+            for (unsigned int i = 0; i < table.names.size(); ++i)
+                table.ids[table.names[i]] = i;
+
+            return table;
+        }
+
+        PropertyTable& getPropertyTable()
+        {
+            static PropertyTable table = createPropertyTable();
+            return table;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyId::PropertyId(const std::string& name)
+    {
+        auto& table = getPropertyTable();
+        const auto it = table.ids.find(name);
+        if (it != table.ids.end())
+            m_id = it->second;
+        else
+        {
+            m_id = static_cast<unsigned int>(table.names.size());
+            table.names.push_back(name);
+            table.ids[name] = m_id;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyId::PropertyId(const char* name) :
+        PropertyId{std::string{name}}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& PropertyId::getName() const
+    {
+        return getPropertyTable().names[m_id];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
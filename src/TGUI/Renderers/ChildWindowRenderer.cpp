@@ -52,12 +52,12 @@ namespace tgui
 
     float ChildWindowRenderer::getTitleBarHeight() const
     {
-        auto it = m_data->propertyValuePairs.find("titlebarheight");
+        auto it = m_data->propertyValuePairs.find(Property::TitleBarHeight);
         if (it != m_data->propertyValuePairs.end())
             return it->second.getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("texturetitlebar");
+            it = m_data->propertyValuePairs.find(Property::TextureTitleBar);
             if (it != m_data->propertyValuePairs.end() && it->second.getTexture().getData())
                 return it->second.getTexture().getImageSize().y;
             else
@@ -69,7 +69,7 @@ namespace tgui
 
     void ChildWindowRenderer::setTitleBarHeight(float number)
     {
-        setProperty("titlebarheight", ObjectConverter{number});
+        setProperty(Property::TitleBarHeight, ObjectConverter{number});
     }
 }
 
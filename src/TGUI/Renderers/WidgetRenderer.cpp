@@ -26,10 +26,36 @@
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/RendererDefines.hpp>
 
+#include <algorithm>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // The renderer functions use the predefined property ids, only names given by the user may still have to be
+        // converted with toLower
+        bool containsUppercase(const std::string& str)
+        {
+            return std::any_of(str.begin(), str.end(), [](char c){ return (c >= 'A') && (c <= 'Z'); });
+        }
+
+        void setPropertyValue(RendererData& data, PropertyId property, ObjectConverter&& value)
+        {
+            auto& storedValue = data.propertyValuePairs[property];
+            if (storedValue != value)
+            {
+                storedValue = std::move(value);
+
+                for (const auto& observer : data.observers)
+                    observer.second(property);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_RENDERER_PROPERTY_GET_NUMBER(WidgetRenderer, Opacity, 1)
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,21 +67,21 @@ namespace tgui
         else if (opacity > 1)
             opacity = 1;
 
-        setProperty("opacity", ObjectConverter{opacity});
+        setProperty(Property::Opacity, ObjectConverter{opacity});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void WidgetRenderer::setFont(Font font)
     {
-        setProperty("font", font);
+        setProperty(Property::Font, font);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font WidgetRenderer::getFont() const
     {
-        auto it = m_data->propertyValuePairs.find("font");
+        auto it = m_data->propertyValuePairs.find(Property::Font);
         if (it != m_data->propertyValuePairs.end())
             return it->second.getFont();
         else
@@ -66,22 +92,30 @@ namespace tgui
 
     void WidgetRenderer::setProperty(const std::string& property, ObjectConverter&& value)
     {
-        std::string lowercaseProperty = toLower(property);
-
-        if (m_data->propertyValuePairs[lowercaseProperty] != value)
+        if (containsUppercase(property))
         {
-            m_data->propertyValuePairs[lowercaseProperty] = value;
-
-            for (const auto& observer : m_data->observers)
-                observer.second(lowercaseProperty);
+            setProperty(toLower(property), std::move(value));
+            return;
         }
+
+        setPropertyValue(*m_data, property, std::move(value));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::setProperty(Property::Id property, ObjectConverter&& value)
+    {
+        setPropertyValue(*m_data, property, std::move(value));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ObjectConverter WidgetRenderer::getProperty(const std::string& property) const
     {
-        auto it = m_data->propertyValuePairs.find(toLower(property));
+        if (containsUppercase(property))
+            return getProperty(toLower(property));
+
+        auto it = m_data->propertyValuePairs.find(property);
         if (it != m_data->propertyValuePairs.end())
             return it->second;
         else
@@ -90,14 +124,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::map<std::string, ObjectConverter>& WidgetRenderer::getPropertyValuePairs() const
+    const std::map<PropertyId, ObjectConverter>& WidgetRenderer::getPropertyValuePairs() const
     {
         return m_data->propertyValuePairs;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void WidgetRenderer::subscribe(const void* id, const std::function<void(const std::string& property)>& function)
+    void WidgetRenderer::subscribe(const void* id, const std::function<void(PropertyId property)>& function)
     {
         m_data->observers[id] = function;
     }
@@ -28,13 +28,16 @@
 #include <TGUI/Widgets/ChildWindow.hpp>
 #include <TGUI/SignalImpl.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace
 {
-    unsigned int lastId = 0;
+    // Signals may be connected from different threads, so the ids are generated atomically
+    std::atomic<unsigned int> lastId{0};
 
     unsigned int generateUniqueId()
     {
@@ -46,13 +49,6 @@ namespace
 
 namespace tgui
 {
-    namespace internal_signal
-    {
-        std::deque<const void*> parameters;
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
     Signal::Signal(const Signal& other) :
         m_name    {other.m_name},
         m_handlers{} // signal handlers are not copied with the widget
@@ -66,7 +62,7 @@ namespace tgui
         if (this != &other)
         {
             m_name = other.m_name;
-            m_handlers.clear(); // signal handlers are not copied with the widget
+            m_handlers = nullptr; // signal handlers are not copied with the widget
         }
 
         return *this;
@@ -77,7 +73,7 @@ namespace tgui
     unsigned int Signal::connect(const Delegate& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = handler;
+        addHandler(id, [handler](const void* const*){ handler(); });
         return id;
     }
 
@@ -88,9 +84,9 @@ namespace tgui
         const auto id = generateUniqueId();
     #ifdef TGUI_NO_CPP14
         std::string name = m_name;
-        m_handlers[id] = [handler, name](){ handler(getWidget(), name); };
+        addHandler(id, [handler, name](const void* const* parameters){ handler(getWidget(parameters), name); });
     #else
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name); };
+        addHandler(id, [handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name); });
     #endif
         return id;
     }
@@ -99,21 +95,120 @@ namespace tgui
 
     bool Signal::disconnect(unsigned int id)
     {
-        return m_handlers.erase(id) == 0;
+        if (!m_handlers)
+            return false;
+
+        // The handlers are sorted on their id because the ids are increasing
+        auto& handlers = m_handlers->handlers;
+        const auto it = std::lower_bound(handlers.begin(), handlers.end(), id, [](const ConnectedHandler& handler, unsigned int value){ return handler.id < value; });
+        if ((it == handlers.end()) || (it->id != id) || !it->connected)
+            return false;
+
+        m_handlers->connectedCount--;
+
+        // The handler can't be destroyed while the signal is being emitted, it might be the one that is currently executing
+        if (m_handlers->emitDepth > 0)
+            it->connected = false;
+        else
+            handlers.erase(it);
+
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_handlers.clear();
+        if (!m_handlers)
+            return;
+
+        if (m_handlers->emitDepth > 0)
+        {
+            for (auto& handler : m_handlers->handlers)
+                handler.connected = false;
+
+            m_handlers->connectedCount = 0;
+        }
+        else
+            m_handlers = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Signal::connectWithParameters(Handler&& handler)
+    {
+        const auto id = generateUniqueId();
+        addHandler(id, std::move(handler));
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Signal::emit(const Widget* widget)
+    {
+        if (!hasHandlers())
+            return false;
+
+        const void* parameters[] = {static_cast<const void*>(&widget)};
+        return callHandlers(parameters);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Signal::callHandlers(const void* const* parameters)
+    {
+        // Keep the handlers alive in case the widget (and this signal) gets destroyed during the handler.
+        // Handlers that are connected while emitting are added at the back and won't be called until the next emit.
+        const auto handlerList = m_handlers;
+        const std::size_t handlerCount = handlerList->handlers.size();
+
+        struct EmitScope
+        {
+            EmitScope(HandlerList& list) :
+                m_list(list)
+            {
+                m_list.emitDepth++;
+            }
+
+            ~EmitScope()
+            {
+                // Remove the handlers that were disconnected while the signal was being emitted
+                if ((--m_list.emitDepth == 0) && (m_list.connectedCount < m_list.handlers.size()))
+                {
+                    m_list.handlers.erase(std::remove_if(m_list.handlers.begin(), m_list.handlers.end(),
+                                                         [](const ConnectedHandler& handler){ return !handler.connected; }),
+                                          m_list.handlers.end());
+                }
+            }
+
+            HandlerList& m_list;
+        } scope{*handlerList};
+
+        for (std::size_t i = 0; i < handlerCount; ++i)
+        {
+            if (handlerList->handlers[i].connected)
+                handlerList->handlers[i].function(parameters);
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Signal::addHandler(unsigned int id, Handler&& handler)
+    {
+        if (!m_handlers)
+            m_handlers = std::make_shared<HandlerList>();
+
+        m_handlers->handlers.push_back({id, std::move(handler), true});
+        m_handlers->connectedCount++;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Widget::Ptr Signal::getWidget()
+    Widget::Ptr Signal::getWidget(const void* const* parameters)
     {
-        return internal_signal::dereference<Widget*>(internal_signal::parameters[0])->shared_from_this();
+        return internal_signal::dereference<Widget*>(parameters[0])->shared_from_this();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -133,7 +228,7 @@ namespace tgui
     unsigned int Signal##TypeName::connect(const Delegate##TypeName& handler) \
     { \
         const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
+        addHandler(id, [handler](const void* const* parameters){ handler(internal_signal::dereference<Type>(parameters[1])); }); \
         return id; \
     } \
     \
@@ -141,7 +236,7 @@ namespace tgui
     { \
         const auto id = generateUniqueId(); \
         std::string name = m_name; \
-        m_handlers[id] = [handler, name](){ handler(getWidget(), name, internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
+        addHandler(id, [handler, name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<Type>(parameters[1])); }); \
         return id; \
     }
 #else
@@ -149,14 +244,14 @@ namespace tgui
     unsigned int Signal##TypeName::connect(const Delegate##TypeName& handler) \
     { \
         const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
+        addHandler(id, [handler](const void* const* parameters){ handler(internal_signal::dereference<Type>(parameters[1])); }); \
         return id; \
     } \
     \
     unsigned int Signal##TypeName::connect(const Delegate##TypeName##Ex& handler) \
     { \
         const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
+        addHandler(id, [handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<Type>(parameters[1])); }); \
         return id; \
     }
 #endif
@@ -257,7 +352,7 @@ namespace tgui
     unsigned int SignalRange::connect(const DelegateRange& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
+        addHandler(id, [handler](const void* const* parameters){ handler(internal_signal::dereference<float>(parameters[1]), internal_signal::dereference<float>(parameters[2])); });
         return id;
     }
 
@@ -268,9 +363,9 @@ namespace tgui
         const auto id = generateUniqueId();
     #ifdef TGUI_NO_CPP14
         std::string name = m_name;
-        m_handlers[id] = [handler, name](){ handler(getWidget(), name, internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<float>(parameters[1]), internal_signal::dereference<float>(parameters[2])); });
     #else
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<float>(parameters[1]), internal_signal::dereference<float>(parameters[2])); });
     #endif
         return id;
     }
@@ -279,12 +374,11 @@ namespace tgui
 
     bool SignalRange::emit(const Widget* widget, float start, float end)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
-        internal_signal::parameters[1] = static_cast<const void*>(&start);
-        internal_signal::parameters[2] = static_cast<const void*>(&end);
-        return Signal::emit(widget);
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&start), static_cast<const void*>(&end)};
+        return callHandlers(parameters);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -306,7 +400,7 @@ namespace tgui
     unsigned int SignalChildWindow::connect(const DelegateChildWindow& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(std::static_pointer_cast<ChildWindow>(internal_signal::dereference<ChildWindow*>(internal_signal::parameters[1])->shared_from_this())); };
+        addHandler(id, [handler](const void* const* parameters){ handler(std::static_pointer_cast<ChildWindow>(internal_signal::dereference<ChildWindow*>(parameters[1])->shared_from_this())); });
         return id;
     }
 
@@ -317,9 +411,9 @@ namespace tgui
         const auto id = generateUniqueId();
     #ifdef TGUI_NO_CPP14
         std::string name = m_name;
-        m_handlers[id] = [handler, name](){ handler(getWidget(), name, std::static_pointer_cast<ChildWindow>(internal_signal::dereference<ChildWindow*>(internal_signal::parameters[1])->shared_from_this())); };
+        addHandler(id, [handler, name](const void* const* parameters){ handler(getWidget(parameters), name, std::static_pointer_cast<ChildWindow>(internal_signal::dereference<ChildWindow*>(parameters[1])->shared_from_this())); });
     #else
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, std::static_pointer_cast<ChildWindow>(internal_signal::dereference<ChildWindow*>(internal_signal::parameters[1])->shared_from_this())); };
+        addHandler(id, [handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, std::static_pointer_cast<ChildWindow>(internal_signal::dereference<ChildWindow*>(parameters[1])->shared_from_this())); });
     #endif
         return id;
     }
@@ -328,11 +422,12 @@ namespace tgui
 
     bool SignalChildWindow::emit(const ChildWindow* childWindow)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
-        internal_signal::parameters[1] = static_cast<const void*>(&childWindow);
-        return Signal::emit(childWindow);
+        const Widget* widget = childWindow;
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&childWindow)};
+        return callHandlers(parameters);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -354,7 +449,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItem& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler](const void* const* parameters){ handler(internal_signal::dereference<sf::String>(parameters[1])); });
         return id;
     }
 
@@ -365,9 +460,9 @@ namespace tgui
         const auto id = generateUniqueId();
     #ifdef TGUI_NO_CPP14
         std::string name = m_name;
-        m_handlers[id] = [handler, name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler, name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1])); });
     #else
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1])); });
     #endif
         return id;
     }
@@ -377,7 +472,7 @@ namespace tgui
     unsigned int SignalItem::connect(const DelegateItemAndId& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
+        addHandler(id, [handler](const void* const* parameters){ handler(internal_signal::dereference<sf::String>(parameters[1]), internal_signal::dereference<sf::String>(parameters[2])); });
         return id;
     }
 
@@ -388,9 +483,9 @@ namespace tgui
         const auto id = generateUniqueId();
     #ifdef TGUI_NO_CPP14
         std::string name = m_name;
-        m_handlers[id] = [handler, name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1]), internal_signal::dereference<sf::String>(parameters[2])); });
     #else
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1]), internal_signal::dereference<sf::String>(parameters[2])); });
     #endif
         return id;
     }
@@ -425,7 +520,7 @@ namespace tgui
     unsigned int SignalMenuItem::connect(const DelegateMenuItem& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler](const void* const* parameters){ handler(internal_signal::dereference<sf::String>(parameters[1])); });
         return id;
     }
 
@@ -436,9 +531,9 @@ namespace tgui
         const auto id = generateUniqueId();
     #ifdef TGUI_NO_CPP14
         std::string name = m_name;
-        m_handlers[id] = [handler, name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler, name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1])); });
     #else
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
+        addHandler(id, [handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1])); });
     #endif
         return id;
     }
@@ -448,7 +543,7 @@ namespace tgui
     unsigned int SignalMenuItem::connect(const DelegateMenuItemFull& handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
+        addHandler(id, [handler](const void* const* parameters){ handler(internal_signal::dereference<std::vector<sf::String>>(parameters[2])); });
         return id;
     }
 
@@ -459,9 +554,9 @@ namespace tgui
         const auto id = generateUniqueId();
     #ifdef TGUI_NO_CPP14
         std::string name = m_name;
-        m_handlers[id] = [handler, name](){ handler(getWidget(), name, internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<std::vector<sf::String>>(parameters[2])); });
     #else
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
+        addHandler(id, [handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<std::vector<sf::String>>(parameters[2])); });
     #endif
         return id;
     }
@@ -25,13 +25,57 @@
 
 #include <TGUI/Text.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/GlyphMetrics.hpp>
+#include <TGUI/VertexBatch.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        void addGlyphQuad(std::vector<sf::Vertex>& vertices, Vector2f position, const sf::Color& color, const sf::Glyph& glyph, float italicShear)
+        {
+            const float padding = 1;
+
+            const float left   = glyph.bounds.left - padding;
+            const float top    = glyph.bounds.top - padding;
+            const float right  = glyph.bounds.left + glyph.bounds.width + padding;
+            const float bottom = glyph.bounds.top  + glyph.bounds.height + padding;
+
+            const float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+            const float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+            const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+            const float v2 = static_cast<float>(glyph.textureRect.top  + glyph.textureRect.height) + padding;
+
+            vertices.push_back({{position.x + left  - italicShear * top,    position.y + top},    color, {u1, v1}});
+            vertices.push_back({{position.x + right - italicShear * top,    position.y + top},    color, {u2, v1}});
+            vertices.push_back({{position.x + left  - italicShear * bottom, position.y + bottom}, color, {u1, v2}});
+            vertices.push_back({{position.x + left  - italicShear * bottom, position.y + bottom}, color, {u1, v2}});
+            vertices.push_back({{position.x + right - italicShear * top,    position.y + top},    color, {u2, v1}});
+            vertices.push_back({{position.x + right - italicShear * bottom, position.y + bottom}, color, {u2, v2}});
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void addLine(std::vector<sf::Vertex>& vertices, float lineLength, float lineTop, const sf::Color& color, float offset, float thickness)
+        {
+            const float top = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
+            const float bottom = top + std::floor(thickness + 0.5f);
+
+            // The font texture always contains a white pixel at (1,1)
+            vertices.push_back({{0,          top},    color, {1, 1}});
+            vertices.push_back({{lineLength, top},    color, {1, 1}});
+            vertices.push_back({{0,          bottom}, color, {1, 1}});
+            vertices.push_back({{0,          bottom}, color, {1, 1}});
+            vertices.push_back({{lineLength, top},    color, {1, 1}});
+            vertices.push_back({{lineLength, bottom}, color, {1, 1}});
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Vector2f Text::getSize() const
@@ -74,6 +118,7 @@ namespace tgui
     void Text::setColor(Color color)
     {
         m_color = color;
+        m_verticesNeedUpdate = true;
 
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         m_text.setFillColor(Color::calcColorOpacity(color, m_opacity));
@@ -94,6 +139,7 @@ namespace tgui
     void Text::setOpacity(float opacity)
     {
         m_opacity = opacity;
+        m_verticesNeedUpdate = true;
 
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         m_text.setFillColor(Color::calcColorOpacity(m_color, opacity));
@@ -182,13 +228,24 @@ namespace tgui
                                          matrix[1], matrix[5], std::floor(matrix[13]),
                                          matrix[3], matrix[7], matrix[15]};
 
-        target.draw(m_text, states);
+        if (VertexBatch::isActive(target) && m_font)
+        {
+            if (m_verticesNeedUpdate)
+                updateVertices();
+
+            states.texture = &m_font.getFont()->getTexture(getCharacterSize());
+            VertexBatch::draw(target, m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles, states);
+        }
+        else
+            target.draw(m_text, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::recalculateSize()
     {
+        m_verticesNeedUpdate = true;
+
         const std::shared_ptr<sf::Font> font = m_font;
         if (font == nullptr)
         {
@@ -202,20 +259,17 @@ namespace tgui
         std::uint32_t prevChar = 0;
         const sf::String& string = m_text.getString();
         const bool bold = (m_text.getStyle() & sf::Text::Bold) != 0;
-        const unsigned int textSize = m_text.getCharacterSize();
+        const auto metrics = GlyphMetrics::get(font, m_text.getCharacterSize(), bold);
         for (std::size_t i = 0; i < string.getSize(); ++i)
         {
-            const float kerning = static_cast<float>(font->getKerning(prevChar, string[i], textSize));
             if (string[i] == '\n')
             {
                 maxWidth = std::max(maxWidth, width);
                 width = 0;
                 lines++;
             }
-            else if (string[i] == '\t')
-                width += (static_cast<float>(font->getGlyph(' ', textSize, bold).advance) * 4) + kerning;
             else
-                width += static_cast<float>(font->getGlyph(string[i], textSize, bold).advance) + kerning;
+                width += metrics->getAdvance(string[i]) + metrics->getKerning(prevChar, string[i]);
 
             prevChar = string[i];
         }
@@ -227,6 +281,85 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Text::updateVertices() const
+    {
+        m_verticesNeedUpdate = false;
+        m_vertices.clear();
+
+        const std::shared_ptr<sf::Font> font = m_font;
+        if (font == nullptr)
+            return;
+
+        // This mimics the way sf::Text positions its glyphs, so that the text looks the same whether it is batched or not
+        const sf::String& string = m_text.getString();
+        const unsigned int textSize = m_text.getCharacterSize();
+        const TextStyle style = m_text.getStyle();
+        const bool bold = (style & sf::Text::Bold) != 0;
+        const bool underlined = (style & sf::Text::Underlined) != 0;
+        const bool strikeThrough = (style & sf::Text::StrikeThrough) != 0;
+        const float italicShear = (style & sf::Text::Italic) ? 0.209f : 0.f; // 12 degrees
+        const sf::Color color = Color::calcColorOpacity(m_color, m_opacity);
+
+        const float underlineOffset = font->getUnderlinePosition(textSize);
+        const float underlineThickness = font->getUnderlineThickness(textSize);
+        const sf::FloatRect xBounds = font->getGlyph('x', textSize, bold).bounds;
+        const float strikeThroughOffset = xBounds.top + xBounds.height / 2.f;
+        const float whitespaceWidth = font->getGlyph(' ', textSize, bold).advance;
+        const float lineSpacing = font->getLineSpacing(textSize);
+
+        m_vertices.reserve(string.getSize() * 6);
+
+        float x = 0;
+        float y = static_cast<float>(textSize);
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < string.getSize(); ++i)
+        {
+            const std::uint32_t curChar = string[i];
+            x += font->getKerning(prevChar, curChar, textSize);
+
+            if ((curChar == '\n') && (prevChar != '\n'))
+            {
+                if (underlined)
+                    addLine(m_vertices, x, y, color, underlineOffset, underlineThickness);
+                if (strikeThrough)
+                    addLine(m_vertices, x, y, color, strikeThroughOffset, underlineThickness);
+            }
+
+            prevChar = curChar;
+
+            if (curChar == ' ')
+            {
+                x += whitespaceWidth;
+                continue;
+            }
+            else if (curChar == '\t')
+            {
+                x += whitespaceWidth * 4;
+                continue;
+            }
+            else if (curChar == '\n')
+            {
+                y += lineSpacing;
+                x = 0;
+                continue;
+            }
+
+            const sf::Glyph& glyph = font->getGlyph(curChar, textSize, bold);
+            addGlyphQuad(m_vertices, {x, y}, color, glyph, italicShear);
+            x += glyph.advance;
+        }
+
+        if (x > 0)
+        {
+            if (underlined)
+                addLine(m_vertices, x, y, color, underlineOffset, underlineThickness);
+            if (strikeThrough)
+                addLine(m_vertices, x, y, color, strikeThroughOffset, underlineThickness);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float Text::getExtraHorizontalPadding(const Text& text)
     {
         return getExtraHorizontalPadding(text.getFont(), text.getCharacterSize(), text.getStyle());
@@ -329,41 +462,61 @@ namespace tgui
         if (font == nullptr)
             return "";
 
-        sf::String result;
+        // Copy the lines and insert a newline wherever a line was wrapped
+        const std::vector<std::size_t> lineBreaks = findLineBreaks(maxWidth, text, font, textSize, bold, dropLeadingSpace);
+        std::basic_string<sf::Uint32> result;
+        result.reserve(text.getSize() + lineBreaks.size());
+
+        std::size_t lineStart = 0;
+        for (const std::size_t lineBreak : lineBreaks)
+        {
+            result.append(text.begin() + lineStart, text.begin() + lineBreak);
+            if (text[lineBreak - 1] != '\n')
+                result += '\n';
+
+            lineStart = lineBreak;
+        }
+
+        result.append(text.begin() + lineStart, text.end());
+        return result;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::size_t> Text::findLineBreaks(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace)
+    {
+        std::vector<std::size_t> lineBreaks;
+        if (font == nullptr)
+            return lineBreaks;
+
+        // The width of a part of the text can be found by subtracting offsets, so a binary search can find where a line ends
+        std::vector<float> offsets;
+        const auto metrics = GlyphMetrics::get(font.getFont(), textSize, bold);
+        metrics->getCharacterOffsets(text, offsets);
+
         std::size_t index = 0;
+        std::size_t lineEnd = 0;
         while (index < text.getSize())
         {
             const std::size_t oldIndex = index;
 
-            // Find out how many characters we can get on this line
-            float width = 0;
-            std::uint32_t prevChar = 0;
-            for (std::size_t i = index; i < text.getSize(); ++i)
-            {
-                float charWidth;
-                const std::uint32_t curChar = text[i];
-                if (curChar == '\n')
-                {
-                    index++;
-                    break;
-                }
-                else if (curChar == '\t')
-                    charWidth = font.getFont()->getGlyph(' ', textSize, bold).advance * 4;
-                else
-                    charWidth = font.getFont()->getGlyph(curChar, textSize, bold).advance;
-
-                const float kerning = font.getFont()->getKerning(prevChar, curChar, textSize);
-                if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
-                {
-                    width += kerning + charWidth;
-                    index++;
-                }
-                else
-                    break;
+            // Search for the next newline, which is only needed again once the previous one has been passed
+            if ((oldIndex == 0) || (oldIndex > lineEnd))
+                lineEnd = static_cast<std::size_t>(std::find(text.begin() + oldIndex, text.end(), '\n') - text.begin());
 
-                prevChar = curChar;
+            // Find out how many characters we can get on this line.
+            // The kerning with the last character of the previous line is not part of the width of the line.
+            if (maxWidth == 0)
+                index = lineEnd;
+            else
+            {
+                const float lineStart = offsets[oldIndex] + ((oldIndex > 0) ? metrics->getKerning(text[oldIndex - 1], text[oldIndex]) : 0);
+                index = static_cast<std::size_t>(std::upper_bound(offsets.begin() + oldIndex + 1, offsets.begin() + lineEnd + 1, lineStart + maxWidth) - offsets.begin()) - 1;
             }
 
+            if ((index == lineEnd) && (lineEnd < text.getSize()))
+                index++;
+
             // Every line contains at least one character
             if (index == oldIndex)
                 index++;
@@ -401,12 +554,12 @@ namespace tgui
                 }
             }
 
-            result += text.substring(oldIndex, index - oldIndex);
-            if ((index < text.getSize()) && (text[index-1] != '\n'))
-                result += "\n";
+            // A new line starts after a wrapped line, but also after a newline at the end of the text
+            if ((index < text.getSize()) || (text[index-1] == '\n'))
+                lineBreaks.push_back(index);
         }
 
-        return result;
+        return lineBreaks;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -207,7 +207,9 @@ namespace tgui
 
     Vector2f Texture::getImageSize() const
     {
-        if (m_data)
+        if (m_data && m_data->atlasTexture)
+            return sf::Vector2f{static_cast<float>(m_data->atlasRect.width), static_cast<float>(m_data->atlasRect.height)};
+        else if (m_data)
             return sf::Vector2f{m_data->texture.getSize()};
         else
             return {0,0};
@@ -217,15 +219,34 @@ namespace tgui
 
     void Texture::setSmooth(bool smooth)
     {
-        if (m_data)
-            m_data->texture.setSmooth(smooth);
+        if (!m_data)
+            return;
+
+        // The atlas is shared with other images, so the image has to be moved to its own texture before it can become smooth
+        if (m_data->atlasTexture)
+        {
+            if (!smooth)
+                return;
+
+            if (m_data->image)
+                m_data->texture.loadFromImage(*m_data->image, m_data->rect);
+            else
+                m_data->texture.loadFromImage(m_data->atlasTexture->copyToImage(), m_data->atlasRect);
+
+            m_data->atlasTexture = nullptr;
+            m_data->atlasRect = {};
+        }
+
+        m_data->texture.setSmooth(smooth);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Texture::isSmooth() const
     {
-        if (m_data)
+        if (m_data && m_data->atlasTexture)
+            return m_data->atlasTexture->isSmooth();
+        else if (m_data)
             return m_data->texture.isSmooth();
         else
             return false;
@@ -253,22 +274,28 @@ namespace tgui
 
     sf::IntRect Texture::getMiddleRect() const
     {
-        return m_middleRect;
+        // The size of the image may not be known yet when the texture is loaded asynchronously
+        if (m_middleRect == sf::IntRect{})
+            return {0, 0, static_cast<int>(getImageSize().x), static_cast<int>(getImageSize().y)};
+        else
+            return m_middleRect;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Texture::isTransparentPixel(sf::Vector2u pixel) const
     {
-        if (!m_data || !m_data->image)
+        if (!m_data || (!m_data->image && !m_data->alphaMask))
             return false;
 
-        assert(pixel.x < m_data->texture.getSize().x && pixel.y < m_data->texture.getSize().y);
+        assert(pixel.x < getImageSize().x && pixel.y < getImageSize().y);
 
-        if (m_data->image->getPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top).a == 0)
-            return true;
+        pixel.x += m_data->rect.left;
+        pixel.y += m_data->rect.top;
+        if (m_data->image)
+            return m_data->image->getPixel(pixel.x, pixel.y).a == 0;
         else
-            return false;
+            return m_data->alphaMask->transparent[pixel.y * m_data->alphaMask->size.x + pixel.x];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -290,9 +317,9 @@ namespace tgui
     bool Texture::operator==(const Texture& right) const
     {
         if (m_id.isEmpty() && right.m_id.isEmpty())
-            return (m_data == right.m_data) && (m_middleRect == right.m_middleRect);
+            return (m_data == right.m_data) && (getMiddleRect() == right.getMiddleRect());
         else
-            return (m_middleRect == right.m_middleRect) && (m_id == right.m_id);
+            return (getMiddleRect() == right.getMiddleRect()) && (m_id == right.m_id);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -340,11 +367,7 @@ namespace tgui
             m_destructCallback(getData());
 
         m_data = data;
-
-        if (middleRect == sf::IntRect{})
-            m_middleRect = {0, 0, static_cast<int>(m_data->texture.getSize().x), static_cast<int>(m_data->texture.getSize().y)};
-        else
-            m_middleRect = middleRect;
+        m_middleRect = middleRect;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
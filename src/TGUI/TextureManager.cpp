@@ -27,11 +27,155 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
 
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <thread>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Maximum width and height of an atlas page, it will be smaller if the graphics card doesn't support textures this big
+        const unsigned int atlasPageSize = 2048;
+
+        // Amount of pixels around each image in the atlas, in which the edges of the image are repeated to prevent the
+        // neighbouring images from bleeding into it
+        const unsigned int atlasPadding = 1;
+
+        // Finds a free place on the page for an image with the given size (including padding)
+        bool findAtlasPosition(unsigned int& shelfTop, unsigned int& shelfHeight, unsigned int& shelfRight, unsigned int pageSize,
+                               sf::Vector2u size, sf::Vector2u& position)
+        {
+            if ((size.x > pageSize) || (size.y > pageSize))
+                return false;
+
+            // Start a new shelf when the image doesn't fit next to the other images on the last one
+            if ((shelfRight + size.x > pageSize) || (shelfTop + size.y > pageSize))
+            {
+                if (shelfTop + shelfHeight + size.y > pageSize)
+                    return false;
+
+                shelfTop += shelfHeight;
+                shelfHeight = 0;
+                shelfRight = 0;
+            }
+
+            position = {shelfRight, shelfTop};
+            shelfRight += size.x;
+            shelfHeight = std::max(shelfHeight, size.y);
+            return true;
+        }
+
+        // Worker threads that decode images for the texture manager when asynchronous loading is enabled.
+        // The threads are only started when the first image is loaded and they are stopped when the program ends.
+        class ImageLoaderThreads
+        {
+        public:
+
+            ~ImageLoaderThreads()
+            {
+                {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    m_stopping = true;
+                    m_queue.clear();
+                }
+
+                m_condition.notify_all();
+                for (auto& thread : m_threads)
+                    thread.join();
+            }
+
+            void load(const std::string& filename, const Texture::ImageLoaderFunc& imageLoader)
+            {
+                {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    m_queue.push_back({filename, imageLoader});
+
+                    if (m_threads.empty())
+                    {
+                        // Leave one core for the gui thread
+                        const unsigned int cores = std::thread::hardware_concurrency();
+                        const unsigned int threadCount = (cores > 2) ? std::min(cores - 1, 4u) : 1;
+                        for (unsigned int i = 0; i < threadCount; ++i)
+                            m_threads.emplace_back([this]{ run(); });
+                    }
+                }
+
+                m_condition.notify_one();
+            }
+
+            bool takeLoadedImage(std::string& filename, std::unique_ptr<sf::Image>& image)
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                if (m_loadedImages.empty())
+                    return false;
+
+                filename = std::move(m_loadedImages.front().first);
+                image = std::move(m_loadedImages.front().second);
+                m_loadedImages.pop_front();
+                return true;
+            }
+
+        private:
+
+            void run()
+            {
+                std::unique_lock<std::mutex> lock{m_mutex};
+                while (true)
+                {
+                    m_condition.wait(lock, [this]{ return m_stopping || !m_queue.empty(); });
+                    if (m_stopping)
+                        return;
+
+                    auto job = std::move(m_queue.front());
+                    m_queue.pop_front();
+
+                    // Decode the image without blocking the other threads
+                    lock.unlock();
+                    std::unique_ptr<sf::Image> image;
+                    try
+                    {
+                        image = job.second(job.first);
+                    }
+                    catch (...)
+                    {
+                        image = nullptr;
+                    }
+                    lock.lock();
+
+                    m_loadedImages.push_back({std::move(job.first), std::move(image)});
+                }
+            }
+
+        private:
+
+            std::vector<std::thread> m_threads;
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            std::deque<std::pair<std::string, Texture::ImageLoaderFunc>> m_queue;
+            std::deque<std::pair<std::string, std::unique_ptr<sf::Image>>> m_loadedImages;
+            bool m_stopping = false;
+        };
+
+        ImageLoaderThreads imageLoaderThreads;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::map<std::string, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    std::vector<TextureManager::AtlasPage> TextureManager::m_atlasPages;
+    bool TextureManager::m_atlasEnabled = false;
+    bool TextureManager::m_alphaMaskEnabled = false;
+    bool TextureManager::m_asyncLoadingEnabled = false;
+    std::size_t TextureManager::m_loadingImageCount = 0;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -63,6 +207,20 @@ namespace tgui
             imageIt = it.first;
         }
 
+        // All parts of the same file share the loaded image and its alpha mask
+        std::shared_ptr<sf::Image> image;
+        std::shared_ptr<AlphaMask> alphaMask;
+        bool imageLoading = false;
+        for (const auto& otherDataHolder : imageIt->second)
+        {
+            if (otherDataHolder.data->image)
+                image = otherDataHolder.data->image;
+            if (otherDataHolder.data->alphaMask)
+                alphaMask = otherDataHolder.data->alphaMask;
+            if (otherDataHolder.data->loading)
+                imageLoading = true;
+        }
+
         // Add new data to the list
         TextureDataHolder dataHolder;
         dataHolder.filename = filename;
@@ -71,30 +229,49 @@ namespace tgui
         dataHolder.data->rect = partRect;
         imageIt->second.push_back(std::move(dataHolder));
 
+        // Remember where the holder is stored, so that it can be found directly when the texture is copied or destroyed
+        auto data = imageIt->second.back().data;
+        data->managerHandleValid = true;
+        data->managerImageIt = imageIt;
+        data->managerHolderIt = std::prev(imageIt->second.end());
+
         // Let the texture alert the texture manager when it is being copied or destroyed
         texture.setCopyCallback(&TextureManager::copyTexture);
         texture.setDestructCallback(&TextureManager::removeTexture);
 
-        // Load the image
-        auto data = imageIt->second.back().data;
-        data->image = texture.getImageLoader()(filename);
-        if (data->image != nullptr)
+        // Load the image, unless it was already loaded for another part of the file.
+        // When loading asynchronously, the texture is created later in processLoadedImages.
+        if (image)
+            data->image = image;
+        else if (imageLoading)
         {
-            // Create a texture from the image
-            bool loadFromImageSuccess;
-            if (partRect == sf::IntRect{})
-                loadFromImageSuccess = data->texture.loadFromImage(*data->image);
-            else
-                loadFromImageSuccess = data->texture.loadFromImage(*data->image, partRect);
+            data->loading = true;
+            return data;
+        }
+        else if (m_asyncLoadingEnabled)
+        {
+            data->loading = true;
+            ++m_loadingImageCount;
+            imageLoaderThreads.load(filename, texture.getImageLoader());
+            return data;
+        }
+        else
+            data->image = texture.getImageLoader()(filename);
 
-            if (loadFromImageSuccess)
+        if (data->image != nullptr)
+        {
+            if (createTexture(*data, alphaMask))
                 return data;
             else
                 return nullptr;
         }
 
         // The image could not be loaded
-        m_imageMap.erase(imageIt);
+        data->managerHandleValid = false;
+        imageIt->second.pop_back();
+        if (imageIt->second.empty())
+            m_imageMap.erase(imageIt);
+
         return nullptr;
     }
 
@@ -102,50 +279,256 @@ namespace tgui
 
     void TextureManager::copyTexture(std::shared_ptr<TextureData> textureDataToCopy)
     {
-        // Loop all our textures to check if we already have this one
-        for (auto& dataHolder : m_imageMap)
+        if (!textureDataToCopy || !textureDataToCopy->managerHandleValid)
+            throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+
+        // The texture is now used at multiple places
+        ++(textureDataToCopy->managerHolderIt->users);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
+    {
+        if (!textureDataToRemove || !textureDataToRemove->managerHandleValid)
+            throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+
+        // If this was the only place where the texture is used then delete it
+        if (--(textureDataToRemove->managerHolderIt->users) == 0)
         {
-            for (auto& data : dataHolder.second)
+            const auto imageIt = textureDataToRemove->managerImageIt;
+            textureDataToRemove->managerHandleValid = false;
+
+            imageIt->second.erase(textureDataToRemove->managerHolderIt);
+            if (imageIt->second.empty())
+                m_imageMap.erase(imageIt);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasEnabled(bool enabled)
+    {
+        m_atlasEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAtlasEnabled()
+    {
+        return m_atlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAlphaMaskEnabled(bool enabled)
+    {
+        m_alphaMaskEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAlphaMaskEnabled()
+    {
+        return m_alphaMaskEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAsyncLoadingEnabled(bool enabled)
+    {
+        m_asyncLoadingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAsyncLoadingEnabled()
+    {
+        return m_asyncLoadingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextureManager::processLoadedImages(sf::Time maxDuration, std::vector<std::shared_ptr<TextureData>>* loadedTextures)
+    {
+        sf::Clock clock;
+        unsigned int count = 0;
+        std::string filename;
+        std::unique_ptr<sf::Image> loadedImage;
+        while (((count == 0) || (clock.getElapsedTime() < maxDuration)) && imageLoaderThreads.takeLoadedImage(filename, loadedImage))
+        {
+            ++count;
+            --m_loadingImageCount;
+
+            // Nothing has to be done when all textures that were waiting for the image have already been destroyed
+            auto imageIt = m_imageMap.find(filename);
+            if (imageIt == m_imageMap.end())
+                continue;
+
+            std::shared_ptr<sf::Image> image = std::move(loadedImage);
+            std::shared_ptr<AlphaMask> alphaMask;
+            for (const auto& dataHolder : imageIt->second)
             {
-                // Check if the pointer points to our texture
-                if (data.data == textureDataToCopy)
+                if (dataHolder.data->alphaMask)
+                    alphaMask = dataHolder.data->alphaMask;
+            }
+
+            // Create the textures for all parts of the image that were requested while it was being loaded
+            for (const auto& dataHolder : imageIt->second)
+            {
+                auto& data = *dataHolder.data;
+                if (!data.loading)
+                    continue;
+
+                data.loading = false;
+                if (!image)
+                    continue;
+
+                data.image = image;
+                if (createTexture(data, alphaMask))
                 {
-                    // The texture is now used at multiple places
-                    ++data.users;
-                    return;
+                    if (loadedTextures)
+                        loadedTextures->push_back(dataHolder.data);
                 }
+                else
+                    TGUI_PRINT_WARNING("Failed to create texture for '" << filename << "'.");
             }
+
+            if (!image)
+                TGUI_PRINT_WARNING("Failed to load '" << filename << "'.");
         }
 
-        throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+        return count;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
+    std::size_t TextureManager::getLoadingImageCount()
+    {
+        return m_loadingImageCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::createTexture(TextureData& data, std::shared_ptr<AlphaMask>& alphaMask)
     {
-        // Loop all our textures to check which one it is
-        for (auto imageIt = m_imageMap.begin(); imageIt != m_imageMap.end(); ++imageIt)
+        // Smooth textures aren't placed in the atlas, as the whole atlas would become smooth
+        bool loadFromImageSuccess = true;
+        if (!m_atlasEnabled || data.texture.isSmooth() || !addToAtlas(data))
         {
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
+            if (data.rect == sf::IntRect{})
+                loadFromImageSuccess = data.texture.loadFromImage(*data.image);
+            else
+                loadFromImageSuccess = data.texture.loadFromImage(*data.image, data.rect);
+        }
+
+        if (m_alphaMaskEnabled)
+        {
+            if (!alphaMask)
             {
-                // Check if the pointer points to our texture
-                if (dataIt->data == textureDataToRemove)
+                alphaMask = std::make_shared<AlphaMask>();
+                alphaMask->size = data.image->getSize();
+                alphaMask->transparent.resize(alphaMask->size.x * alphaMask->size.y);
+                for (unsigned int y = 0; y < alphaMask->size.y; ++y)
                 {
-                    // If this was the only place where the texture is used then delete it
-                    if (--(dataIt->users) == 0)
-                    {
-                        imageIt->second.erase(dataIt);
-                        if (imageIt->second.empty())
-                            m_imageMap.erase(imageIt);
-                    }
-
-                    return;
+                    for (unsigned int x = 0; x < alphaMask->size.x; ++x)
+                        alphaMask->transparent[y * alphaMask->size.x + x] = (data.image->getPixel(x, y).a == 0);
                 }
             }
+
+            data.alphaMask = alphaMask;
+            data.image = nullptr;
+        }
+
+        return loadFromImageSuccess;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::addToAtlas(TextureData& data)
+    {
+        // Find the part of the image that has to be stored, limited to the image like sf::Texture::loadFromImage would do
+        const sf::Vector2u imageSize = data.image->getSize();
+        sf::IntRect area = data.rect;
+        if (area == sf::IntRect{})
+            area = {0, 0, static_cast<int>(imageSize.x), static_cast<int>(imageSize.y)};
+        else
+        {
+            area.left = std::max(area.left, 0);
+            area.top = std::max(area.top, 0);
+            area.width = std::min(area.width, static_cast<int>(imageSize.x) - area.left);
+            area.height = std::min(area.height, static_cast<int>(imageSize.y) - area.top);
+        }
+
+        if ((area.width <= 0) || (area.height <= 0))
+            return false;
+
+        const sf::Vector2u paddedSize{static_cast<unsigned int>(area.width) + 2 * atlasPadding, static_cast<unsigned int>(area.height) + 2 * atlasPadding};
+
+        // Search for a page with enough free space, pages of which all images were removed are forgotten
+        std::shared_ptr<sf::Texture> atlasTexture;
+        sf::Vector2u position;
+        for (auto pageIt = m_atlasPages.begin(); pageIt != m_atlasPages.end();)
+        {
+            auto texture = pageIt->texture.lock();
+            if (!texture)
+            {
+                pageIt = m_atlasPages.erase(pageIt);
+                continue;
+            }
+
+            if (findAtlasPosition(pageIt->shelfTop, pageIt->shelfHeight, pageIt->shelfRight, pageIt->size, paddedSize, position))
+            {
+                atlasTexture = texture;
+                break;
+            }
+
+            ++pageIt;
+        }
+
+        // Create a new page if the image didn't fit on any existing page
+        if (!atlasTexture)
+        {
+            AtlasPage page;
+            page.size = std::min(atlasPageSize, sf::Texture::getMaximumSize());
+            if (!findAtlasPosition(page.shelfTop, page.shelfHeight, page.shelfRight, page.size, paddedSize, position))
+                return false;
+
+            atlasTexture = std::make_shared<sf::Texture>();
+            if (!atlasTexture->create(page.size, page.size))
+                return false;
+
+            page.texture = atlasTexture;
+            m_atlasPages.push_back(page);
         }
 
-        throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+        // Copy the image with its edges repeated in the padding around it
+        sf::Image paddedImage;
+        paddedImage.create(paddedSize.x, paddedSize.y);
+        paddedImage.copy(*data.image, atlasPadding, atlasPadding, area);
+        for (unsigned int x = 0; x < paddedSize.x; ++x)
+        {
+            const unsigned int sourceX = std::min(std::max(x, atlasPadding), paddedSize.x - atlasPadding - 1);
+            for (unsigned int y = 0; y < atlasPadding; ++y)
+            {
+                paddedImage.setPixel(x, y, paddedImage.getPixel(sourceX, atlasPadding));
+                paddedImage.setPixel(x, paddedSize.y - 1 - y, paddedImage.getPixel(sourceX, paddedSize.y - atlasPadding - 1));
+            }
+        }
+        for (unsigned int y = 0; y < paddedSize.y; ++y)
+        {
+            for (unsigned int x = 0; x < atlasPadding; ++x)
+            {
+                paddedImage.setPixel(x, y, paddedImage.getPixel(atlasPadding, y));
+                paddedImage.setPixel(paddedSize.x - 1 - x, y, paddedImage.getPixel(paddedSize.x - atlasPadding - 1, y));
+            }
+        }
+
+        atlasTexture->update(paddedImage, position.x, position.y);
+
+        data.atlasTexture = atlasTexture;
+        data.atlasRect = {static_cast<int>(position.x + atlasPadding), static_cast<int>(position.y + atlasPadding), area.width, area.height};
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,397 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/VertexBatch.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <array>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        enum class ClipEdge
+        {
+            Left,
+            Top,
+            Right,
+            Bottom
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isInside(const sf::Vertex& vertex, const sf::FloatRect& rect, ClipEdge edge)
+        {
+            switch (edge)
+            {
+                case ClipEdge::Left:   return vertex.position.x >= rect.left;
+                case ClipEdge::Top:    return vertex.position.y >= rect.top;
+                case ClipEdge::Right:  return vertex.position.x <= rect.left + rect.width;
+                case ClipEdge::Bottom: return vertex.position.y <= rect.top + rect.height;
+            }
+
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::Vertex intersect(const sf::Vertex& v1, const sf::Vertex& v2, const sf::FloatRect& rect, ClipEdge edge)
+        {
+            float ratio;
+            switch (edge)
+            {
+                case ClipEdge::Left:   ratio = (rect.left - v1.position.x) / (v2.position.x - v1.position.x); break;
+                case ClipEdge::Top:    ratio = (rect.top - v1.position.y) / (v2.position.y - v1.position.y); break;
+                case ClipEdge::Right:  ratio = (rect.left + rect.width - v1.position.x) / (v2.position.x - v1.position.x); break;
+                case ClipEdge::Bottom: ratio = (rect.top + rect.height - v1.position.y) / (v2.position.y - v1.position.y); break;
+                default: ratio = 0;
+            }
+
+            auto lerp = [ratio](sf::Uint8 from, sf::Uint8 to) {
+                    return static_cast<sf::Uint8>(from + ratio * (to - from) + 0.5f);
+                };
+
+            return {v1.position + ratio * (v2.position - v1.position),
+                    {lerp(v1.color.r, v2.color.r), lerp(v1.color.g, v2.color.g), lerp(v1.color.b, v2.color.b), lerp(v1.color.a, v2.color.a)},
+                    v1.texCoords + ratio * (v2.texCoords - v1.texCoords)};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Calculates a view that only shows the clipping area, this is only needed for things that can't be clipped on the CPU
+        sf::View calculateClipView(const sf::View& view, const sf::FloatRect& rect)
+        {
+            if ((rect.width <= 0) || (rect.height <= 0))
+            {
+                sf::View emptyView{{0, 0, 0, 0}};
+                emptyView.setViewport({0, 0, 0, 0});
+                return emptyView;
+            }
+
+            const sf::FloatRect& viewport = view.getViewport();
+            const sf::Vector2f viewTopLeft = view.getCenter() - (view.getSize() / 2.f);
+
+            sf::View clipView{rect};
+            clipView.setViewport({viewport.left + ((rect.left - viewTopLeft.x) / view.getSize().x * viewport.width),
+                                  viewport.top + ((rect.top - viewTopLeft.y) / view.getSize().y * viewport.height),
+                                  rect.width / view.getSize().x * viewport.width,
+                                  rect.height / view.getSize().y * viewport.height});
+            return clipView;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::RenderTarget* VertexBatch::m_target = nullptr;
+    sf::RenderStates VertexBatch::m_states;
+    std::vector<sf::Vertex> VertexBatch::m_vertices;
+    std::vector<sf::Vertex> VertexBatch::m_shapeVertices;
+    unsigned int VertexBatch::m_pauseCount = 0;
+    unsigned int VertexBatch::m_drawCallCount = 0;
+    std::vector<sf::FloatRect> VertexBatch::m_clipRects;
+    sf::View VertexBatch::m_viewBeforePause;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template <typename Func>
+    void VertexBatch::drawUnbatched(sf::RenderTarget& target, const Func& func)
+    {
+        flush();
+
+        if (isActive(target) && !m_clipRects.empty())
+        {
+            const sf::View oldView = target.getView();
+            target.setView(calculateClipView(oldView, m_clipRects.back()));
+            func();
+            target.setView(oldView);
+        }
+        else
+            func();
+
+        ++m_drawCallCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VertexBatch::begin(sf::RenderTarget& target)
+    {
+        assert(m_target == nullptr);
+
+        m_target = &target;
+        m_states = sf::RenderStates::Default;
+        m_vertices.clear();
+        m_clipRects.clear();
+        m_pauseCount = 0;
+        m_drawCallCount = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VertexBatch::end()
+    {
+        flush();
+        m_target = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool VertexBatch::isActive(const sf::RenderTarget& target)
+    {
+        return (m_target == &target) && (m_pauseCount == 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VertexBatch::flush()
+    {
+        if (!m_target || m_vertices.empty())
+            return;
+
+        m_target->draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles, m_states);
+        m_vertices.clear();
+        ++m_drawCallCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VertexBatch::pause()
+    {
+        flush();
+
+        // Widgets that are drawn directly still have to be clipped by the containers in which they are located
+        if (m_target && (m_pauseCount == 0) && !m_clipRects.empty())
+        {
+            m_viewBeforePause = m_target->getView();
+            m_target->setView(calculateClipView(m_viewBeforePause, m_clipRects.back()));
+        }
+
+        ++m_pauseCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VertexBatch::resume()
+    {
+        assert(m_pauseCount > 0);
+        --m_pauseCount;
+
+        if (m_target && (m_pauseCount == 0) && !m_clipRects.empty())
+            m_target->setView(m_viewBeforePause);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VertexBatch::draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states)
+    {
+        if (!isActive(target)
+         || ((type != sf::PrimitiveType::Triangles) && (type != sf::PrimitiveType::TrianglesStrip) && (type != sf::PrimitiveType::TrianglesFan)))
+        {
+            drawUnbatched(target, [&]{ target.draw(vertices, vertexCount, type, states); });
+            return;
+        }
+
+        if (vertexCount < 3)
+            return;
+
+        prepare(states);
+
+        // Transform the vertices on the CPU, the batch itself is drawn without a transform
+        auto transformed = [&](std::size_t index){
+                sf::Vertex vertex = vertices[index];
+                vertex.position = states.transform.transformPoint(vertex.position);
+                return vertex;
+            };
+
+        if (type == sf::PrimitiveType::Triangles)
+        {
+            for (std::size_t i = 0; i + 2 < vertexCount; i += 3)
+                addTriangle(transformed(i), transformed(i+1), transformed(i+2));
+        }
+        else if (type == sf::PrimitiveType::TrianglesStrip)
+        {
+            for (std::size_t i = 0; i + 2 < vertexCount; ++i)
+                addTriangle(transformed(i), transformed(i+1), transformed(i+2));
+        }
+        else // TrianglesFan
+        {
+            const sf::Vertex center = transformed(0);
+            for (std::size_t i = 1; i + 1 < vertexCount; ++i)
+                addTriangle(center, transformed(i), transformed(i+1));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VertexBatch::draw(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states)
+    {
+        if (!isActive(target) || shape.getTexture() || (shape.getOutlineThickness() != 0) || (shape.getPointCount() < 3))
+        {
+            draw(target, static_cast<const sf::Drawable&>(shape), states);
+            return;
+        }
+
+        sf::RenderStates shapeStates = states;
+        shapeStates.transform *= shape.getTransform();
+        shapeStates.texture = nullptr;
+
+        // Shapes are always convex, so the points can be drawn as a triangle fan
+        m_shapeVertices.resize(shape.getPointCount());
+        for (std::size_t i = 0; i < m_shapeVertices.size(); ++i)
+            m_shapeVertices[i] = {shape.getPoint(i), shape.getFillColor()};
+
+        draw(target, m_shapeVertices.data(), m_shapeVertices.size(), sf::PrimitiveType::TrianglesFan, shapeStates);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VertexBatch::draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        drawUnbatched(target, [&]{ target.draw(drawable, states); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VertexBatch::pushClipRect(const sf::FloatRect& rect)
+    {
+        assert(m_target != nullptr);
+
+        sf::FloatRect visibleRect;
+        if (m_clipRects.empty())
+        {
+            const sf::View& view = m_target->getView();
+            visibleRect = {view.getCenter() - (view.getSize() / 2.f), view.getSize()};
+        }
+        else
+            visibleRect = m_clipRects.back();
+
+        sf::FloatRect intersection;
+        if (!visibleRect.intersects(rect, intersection))
+            intersection = {0, 0, 0, 0};
+
+        m_clipRects.push_back(intersection);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VertexBatch::popClipRect()
+    {
+        assert(!m_clipRects.empty());
+        m_clipRects.pop_back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int VertexBatch::getDrawCallCount()
+    {
+        return m_drawCallCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VertexBatch::prepare(const sf::RenderStates& states)
+    {
+        if ((states.texture != m_states.texture) || (states.shader != m_states.shader) || (states.blendMode != m_states.blendMode))
+        {
+            flush();
+
+            m_states.texture = states.texture;
+            m_states.shader = states.shader;
+            m_states.blendMode = states.blendMode;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void VertexBatch::addTriangle(const sf::Vertex& v1, const sf::Vertex& v2, const sf::Vertex& v3)
+    {
+        if (m_clipRects.empty())
+        {
+            m_vertices.push_back(v1);
+            m_vertices.push_back(v2);
+            m_vertices.push_back(v3);
+            return;
+        }
+
+        const sf::FloatRect& rect = m_clipRects.back();
+        if ((rect.width <= 0) || (rect.height <= 0))
+            return;
+
+        // Most triangles lie either completely inside or completely outside the clipping area
+        const float minX = std::min({v1.position.x, v2.position.x, v3.position.x});
+        const float maxX = std::max({v1.position.x, v2.position.x, v3.position.x});
+        const float minY = std::min({v1.position.y, v2.position.y, v3.position.y});
+        const float maxY = std::max({v1.position.y, v2.position.y, v3.position.y});
+        if ((maxX <= rect.left) || (minX >= rect.left + rect.width) || (maxY <= rect.top) || (minY >= rect.top + rect.height))
+            return;
+
+        if ((minX >= rect.left) && (maxX <= rect.left + rect.width) && (minY >= rect.top) && (maxY <= rect.top + rect.height))
+        {
+            m_vertices.push_back(v1);
+            m_vertices.push_back(v2);
+            m_vertices.push_back(v3);
+            return;
+        }
+
+        // Cut the triangle with each side of the clipping area (Sutherland-Hodgman), the result has at most 7 corners
+        std::array<sf::Vertex, 9> polygon = {{v1, v2, v3}};
+        std::array<sf::Vertex, 9> clipped;
+        std::size_t pointCount = 3;
+        for (const auto edge : {ClipEdge::Left, ClipEdge::Top, ClipEdge::Right, ClipEdge::Bottom})
+        {
+            std::size_t clippedCount = 0;
+            for (std::size_t i = 0; i < pointCount; ++i)
+            {
+                const sf::Vertex& current = polygon[i];
+                const sf::Vertex& next = polygon[(i + 1) % pointCount];
+                const bool currentInside = isInside(current, rect, edge);
+                const bool nextInside = isInside(next, rect, edge);
+
+                if (currentInside)
+                    clipped[clippedCount++] = current;
+                if (currentInside != nextInside)
+                    clipped[clippedCount++] = intersect(current, next, rect, edge);
+            }
+
+            polygon = clipped;
+            pointCount = clippedCount;
+            if (pointCount < 3)
+                return;
+        }
+
+        for (std::size_t i = 1; i + 1 < pointCount; ++i)
+        {
+            m_vertices.push_back(polygon[0]);
+            m_vertices.push_back(polygon[i]);
+            m_vertices.push_back(polygon[i+1]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
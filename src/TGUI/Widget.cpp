@@ -28,8 +28,11 @@
 #include <TGUI/Animation.hpp>
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/LayoutSolver.hpp>
+#include <TGUI/VertexBatch.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -71,6 +74,8 @@ namespace tgui
 
     Widget::~Widget()
     {
+        LayoutSolver::removeWidget(this);
+
         // The renderer will be null when the widget was moved
         if (m_renderer)
             m_renderer->unsubscribe(this);
@@ -98,16 +103,18 @@ namespace tgui
         m_allowFocus                   {other.m_allowFocus},
         m_draggableWidget              {other.m_draggableWidget},
         m_containerWidget              {other.m_containerWidget},
+        m_batchableWidgetType          {other.m_batchableWidgetType},
+        m_mouseOnWidgetInsideBoundsType{other.m_mouseOnWidgetInsideBoundsType},
         m_toolTip                      {other.m_toolTip ? other.m_toolTip->clone() : nullptr},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {other.m_showAnimations},
         m_fontCached                   {other.m_fontCached},
         m_opacityCached                {other.m_opacityCached}
     {
-        m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-        m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
-        m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-        m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+        m_position.x.connectWidget(this, true, [this]{ LayoutSolver::positionChanged(this); });
+        m_position.y.connectWidget(this, false, [this]{ LayoutSolver::positionChanged(this); });
+        m_size.x.connectWidget(this, true, [this]{ LayoutSolver::sizeChanged(this); });
+        m_size.y.connectWidget(this, false, [this]{ LayoutSolver::sizeChanged(this); });
 
         m_renderer->subscribe(this, m_rendererChangedCallback);
     }
@@ -138,16 +145,18 @@ namespace tgui
         m_animationTimeElapsed         {std::move(other.m_animationTimeElapsed)},
         m_draggableWidget              {std::move(other.m_draggableWidget)},
         m_containerWidget              {std::move(other.m_containerWidget)},
+        m_batchableWidgetType          {std::move(other.m_batchableWidgetType)},
+        m_mouseOnWidgetInsideBoundsType{std::move(other.m_mouseOnWidgetInsideBoundsType)},
         m_toolTip                      {std::move(other.m_toolTip)},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {std::move(other.m_showAnimations)},
         m_fontCached                   {std::move(other.m_fontCached)},
         m_opacityCached                {std::move(other.m_opacityCached)}
     {
-        m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-        m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
-        m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-        m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+        m_position.x.connectWidget(this, true, [this]{ LayoutSolver::positionChanged(this); });
+        m_position.y.connectWidget(this, false, [this]{ LayoutSolver::positionChanged(this); });
+        m_size.x.connectWidget(this, true, [this]{ LayoutSolver::sizeChanged(this); });
+        m_size.y.connectWidget(this, false, [this]{ LayoutSolver::sizeChanged(this); });
 
         other.m_renderer->unsubscribe(&other);
         m_renderer->subscribe(this, m_rendererChangedCallback);
@@ -173,31 +182,33 @@ namespace tgui
             onMouseEnter.disconnectAll();
             onMouseLeave.disconnectAll();
 
-            m_type                 = other.m_type;
-            m_position             = other.m_position;
-            m_size                 = other.m_size;
-            m_boundPositionLayouts = {};
-            m_boundSizeLayouts     = {};
-            m_enabled              = other.m_enabled;
-            m_visible              = other.m_visible;
-            m_parent               = nullptr;
-            m_mouseHover           = false;
-            m_mouseDown            = false;
-            m_focused              = false;
-            m_allowFocus           = other.m_allowFocus;
-            m_animationTimeElapsed = {};
-            m_draggableWidget      = other.m_draggableWidget;
-            m_containerWidget      = other.m_containerWidget;
-            m_toolTip              = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
-            m_renderer             = other.m_renderer;
-            m_showAnimations       = {};
-            m_fontCached           = other.m_fontCached;
-            m_opacityCached        = other.m_opacityCached;
-
-            m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-            m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
-            m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-            m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+            m_type                          = other.m_type;
+            m_position                      = other.m_position;
+            m_size                          = other.m_size;
+            m_boundPositionLayouts          = {};
+            m_boundSizeLayouts              = {};
+            m_enabled                       = other.m_enabled;
+            m_visible                       = other.m_visible;
+            m_parent                        = nullptr;
+            m_mouseHover                    = false;
+            m_mouseDown                     = false;
+            m_focused                       = false;
+            m_allowFocus                    = other.m_allowFocus;
+            m_animationTimeElapsed          = {};
+            m_draggableWidget               = other.m_draggableWidget;
+            m_containerWidget               = other.m_containerWidget;
+            m_batchableWidgetType           = other.m_batchableWidgetType;
+            m_mouseOnWidgetInsideBoundsType = other.m_mouseOnWidgetInsideBoundsType;
+            m_toolTip                       = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
+            m_renderer                      = other.m_renderer;
+            m_showAnimations                = {};
+            m_fontCached                    = other.m_fontCached;
+            m_opacityCached                 = other.m_opacityCached;
+
+            m_position.x.connectWidget(this, true, [this]{ LayoutSolver::positionChanged(this); });
+            m_position.y.connectWidget(this, false, [this]{ LayoutSolver::positionChanged(this); });
+            m_size.x.connectWidget(this, true, [this]{ LayoutSolver::sizeChanged(this); });
+            m_size.y.connectWidget(this, false, [this]{ LayoutSolver::sizeChanged(this); });
 
             m_renderer->subscribe(this, m_rendererChangedCallback);
         }
@@ -217,37 +228,39 @@ namespace tgui
             SignalWidgetBase::operator=(std::move(other));
             enable_shared_from_this::operator=(std::move(other));
 
-            onPositionChange       = std::move(other.onPositionChange);
-            onSizeChange           = std::move(other.onSizeChange);
-            onFocus                = std::move(other.onFocus);
-            onUnfocus              = std::move(other.onUnfocus);
-            onMouseEnter           = std::move(other.onMouseEnter);
-            onMouseLeave           = std::move(other.onMouseLeave);
-            m_type                 = std::move(other.m_type);
-            m_position             = std::move(other.m_position);
-            m_size                 = std::move(other.m_size);
-            m_boundPositionLayouts = std::move(other.m_boundPositionLayouts);
-            m_boundSizeLayouts     = std::move(other.m_boundSizeLayouts);
-            m_enabled              = std::move(other.m_enabled);
-            m_visible              = std::move(other.m_visible);
-            m_parent               = nullptr;
-            m_mouseHover           = std::move(other.m_mouseHover);
-            m_mouseDown            = std::move(other.m_mouseDown);
-            m_focused              = std::move(other.m_focused);
-            m_animationTimeElapsed = std::move(other.m_animationTimeElapsed);
-            m_allowFocus           = std::move(other.m_allowFocus);
-            m_draggableWidget      = std::move(other.m_draggableWidget);
-            m_containerWidget      = std::move(other.m_containerWidget);
-            m_toolTip              = std::move(other.m_toolTip);
-            m_renderer             = std::move(other.m_renderer);
-            m_showAnimations       = std::move(other.m_showAnimations);
-            m_fontCached           = std::move(other.m_fontCached);
-            m_opacityCached        = std::move(other.m_opacityCached);
-
-            m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-            m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
-            m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-            m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+            onPositionChange                = std::move(other.onPositionChange);
+            onSizeChange                    = std::move(other.onSizeChange);
+            onFocus                         = std::move(other.onFocus);
+            onUnfocus                       = std::move(other.onUnfocus);
+            onMouseEnter                    = std::move(other.onMouseEnter);
+            onMouseLeave                    = std::move(other.onMouseLeave);
+            m_type                          = std::move(other.m_type);
+            m_position                      = std::move(other.m_position);
+            m_size                          = std::move(other.m_size);
+            m_boundPositionLayouts          = std::move(other.m_boundPositionLayouts);
+            m_boundSizeLayouts              = std::move(other.m_boundSizeLayouts);
+            m_enabled                       = std::move(other.m_enabled);
+            m_visible                       = std::move(other.m_visible);
+            m_parent                        = nullptr;
+            m_mouseHover                    = std::move(other.m_mouseHover);
+            m_mouseDown                     = std::move(other.m_mouseDown);
+            m_focused                       = std::move(other.m_focused);
+            m_animationTimeElapsed          = std::move(other.m_animationTimeElapsed);
+            m_allowFocus                    = std::move(other.m_allowFocus);
+            m_draggableWidget               = std::move(other.m_draggableWidget);
+            m_containerWidget               = std::move(other.m_containerWidget);
+            m_batchableWidgetType           = std::move(other.m_batchableWidgetType);
+            m_mouseOnWidgetInsideBoundsType = std::move(other.m_mouseOnWidgetInsideBoundsType);
+            m_toolTip                       = std::move(other.m_toolTip);
+            m_renderer                      = std::move(other.m_renderer);
+            m_showAnimations                = std::move(other.m_showAnimations);
+            m_fontCached                    = std::move(other.m_fontCached);
+            m_opacityCached                 = std::move(other.m_opacityCached);
+
+            m_position.x.connectWidget(this, true, [this]{ LayoutSolver::positionChanged(this); });
+            m_position.y.connectWidget(this, false, [this]{ LayoutSolver::positionChanged(this); });
+            m_size.x.connectWidget(this, true, [this]{ LayoutSolver::sizeChanged(this); });
+            m_size.y.connectWidget(this, false, [this]{ LayoutSolver::sizeChanged(this); });
 
             m_renderer->subscribe(this, m_rendererChangedCallback);
 
@@ -307,6 +320,8 @@ namespace tgui
             rendererChanged(newIt->first);
             ++newIt;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -359,13 +374,25 @@ namespace tgui
 
     void Widget::setPosition(const Layout2d& position)
     {
+        const Vector2f oldPosition = m_prevPosition;
         m_position = position;
-        m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-        m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
+        m_position.x.connectWidget(this, true, [this]{ LayoutSolver::positionChanged(this); });
+        m_position.y.connectWidget(this, false, [this]{ LayoutSolver::positionChanged(this); });
 
         if (getPosition() != m_prevPosition)
         {
+            // Both the area where the widget was and where it is now have to be redrawn
+            if (m_parent && m_visible)
+            {
+                m_parent->invalidateChildRegion({oldPosition + getWidgetOffset(), getFullSize()});
+                invalidate();
+            }
+
             m_prevPosition = getPosition();
+
+            if (m_parent)
+                m_parent->m_spatialIndexNeedsUpdate = true;
+
             onPositionChange.emit(this, getPosition());
 
             for (auto& layout : m_boundPositionLayouts)
@@ -378,12 +405,25 @@ namespace tgui
     void Widget::setSize(const Layout2d& size)
     {
         m_size = size;
-        m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-        m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+        m_size.x.connectWidget(this, true, [this]{ LayoutSolver::sizeChanged(this); });
+        m_size.y.connectWidget(this, false, [this]{ LayoutSolver::sizeChanged(this); });
 
         if (getSize() != m_prevSize)
         {
+            // The old size isn't known anymore, so the area is made large enough to contain both the old and new size
+            if (m_parent && m_visible)
+            {
+                const Vector2f fullSize = getFullSize();
+                m_parent->invalidateChildRegion({getPosition() + getWidgetOffset(),
+                                                 {std::max(fullSize.x, fullSize.x - getSize().x + m_prevSize.x),
+                                                  std::max(fullSize.y, fullSize.y - getSize().y + m_prevSize.y)}});
+            }
+
             m_prevSize = getSize();
+
+            if (m_parent)
+                m_parent->m_spatialIndexNeedsUpdate = true;
+
             onSizeChange.emit(this, getSize());
 
             for (auto& layout : m_boundSizeLayouts)
@@ -420,6 +460,7 @@ namespace tgui
     void Widget::show()
     {
         m_visible = true;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -491,6 +532,7 @@ namespace tgui
 
     void Widget::hide()
     {
+        invalidate();
         m_visible = false;
 
         // If the widget is focused then it must be unfocused
@@ -558,6 +600,7 @@ namespace tgui
     void Widget::enable()
     {
         m_enabled = true;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -565,6 +608,7 @@ namespace tgui
     void Widget::disable()
     {
         m_enabled = false;
+        invalidate();
 
         // Change the mouse button state.
         m_mouseHover = false;
@@ -615,10 +659,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::invalidate()
+    {
+        if (m_parent && m_visible)
+            m_parent->invalidateChildRegion({getPosition() + getWidgetOffset(), getFullSize()});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setInheritedFont(const Font& font)
     {
         m_inheritedFont = font;
-        rendererChanged("font");
+        rendererChanged(Property::Font);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -633,7 +686,8 @@ namespace tgui
     void Widget::setInheritedOpacity(float opacity)
     {
         m_inheritedOpacity = opacity;
-        rendererChanged("opacity");
+        rendererChanged(Property::Opacity);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -671,10 +725,10 @@ namespace tgui
         m_parent = parent;
 
         // Give the layouts another chance to find widgets to which it refers
-        m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
-        m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
-        m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
-        m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+        m_position.x.connectWidget(this, true, [this]{ LayoutSolver::positionChanged(this); });
+        m_position.y.connectWidget(this, false, [this]{ LayoutSolver::positionChanged(this); });
+        m_size.x.connectWidget(this, true, [this]{ LayoutSolver::sizeChanged(this); });
+        m_size.y.connectWidget(this, false, [this]{ LayoutSolver::sizeChanged(this); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -683,6 +737,9 @@ namespace tgui
     {
         m_animationTimeElapsed += elapsedTime;
 
+        if (!m_showAnimations.empty())
+            invalidate();
+
         for (unsigned int i = 0; i < m_showAnimations.size();)
         {
             if (m_showAnimations[i]->update(elapsedTime))
@@ -746,6 +803,7 @@ namespace tgui
 
     void Widget::widgetFocused()
     {
+        invalidate();
         onFocus.emit(this);
 
         // Make sure the parent is also focused
@@ -757,6 +815,7 @@ namespace tgui
 
     void Widget::widgetUnfocused()
     {
+        invalidate();
         onUnfocus.emit(this);
     }
 
@@ -772,6 +831,9 @@ namespace tgui
 
     void Widget::mouseNoLongerDown()
     {
+        if (m_mouseDown)
+            invalidate();
+
         m_mouseDown = false;
     }
 
@@ -817,41 +879,50 @@ namespace tgui
 
     Signal& Widget::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onPositionChange.getName()))
-            return onPositionChange;
-        else if (signalName == toLower(onSizeChange.getName()))
-            return onSizeChange;
-        else if (signalName == toLower(onFocus.getName()))
-            return onFocus;
-        else if (signalName == toLower(onUnfocus.getName()))
-            return onUnfocus;
-        else if (signalName == toLower(onMouseEnter.getName()))
-            return onMouseEnter;
-        else if (signalName == toLower(onMouseLeave.getName()))
-            return onMouseLeave;
+        static const auto signalMap = createSignalMap<Widget>(*this, {
+                [](Widget& widget) -> Signal& { return widget.onPositionChange; },
+                [](Widget& widget) -> Signal& { return widget.onSizeChange; },
+                [](Widget& widget) -> Signal& { return widget.onFocus; },
+                [](Widget& widget) -> Signal& { return widget.onUnfocus; },
+                [](Widget& widget) -> Signal& { return widget.onMouseEnter; },
+                [](Widget& widget) -> Signal& { return widget.onMouseLeave; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
 
         throw Exception{"No signal exists with name '" + std::move(signalName) + "'."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::rendererChanged(const std::string& property)
+    void Widget::rendererChanged(PropertyId property)
     {
-        if (property == "opacity")
+        switch (property.getId())
         {
-            m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
-        }
-        else if (property == "font")
-        {
-            if (getSharedRenderer()->getFont())
-                m_fontCached = getSharedRenderer()->getFont();
-            else if (m_inheritedFont)
-                m_fontCached = m_inheritedFont;
-            else
-                m_fontCached = getGlobalFont();
+            case Property::Opacity:
+            {
+                m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
+                break;
+            }
+
+            case Property::Font:
+            {
+                if (getSharedRenderer()->getFont())
+                    m_fontCached = getSharedRenderer()->getFont();
+                else if (m_inheritedFont)
+                    m_fontCached = m_inheritedFont;
+                else
+                    m_fontCached = getGlobalFont();
+                break;
+            }
+
+            default:
+            {
+                throw Exception{"Could not set property '" + property.getName() + "', widget of type '" + getWidgetType() + "' does not has this property."};
+            }
         }
-        else
-            throw Exception{"Could not set property '" + property + "', widget of type '" + getWidgetType() + "' does not has this property."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1010,6 +1081,7 @@ namespace tgui
     void Widget::mouseEnteredWidget()
     {
         m_mouseHover = true;
+        invalidate();
         onMouseEnter.emit(this);
     }
 
@@ -1018,14 +1090,16 @@ namespace tgui
     void Widget::mouseLeftWidget()
     {
         m_mouseHover = false;
+        invalidate();
         onMouseLeave.emit(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::rendererChangedCallback(const std::string& property)
+    void Widget::rendererChangedCallback(PropertyId property)
     {
         rendererChanged(property);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1042,7 +1116,7 @@ namespace tgui
         else
             shape.setFillColor(color);
 
-        target.draw(shape, states);
+        VertexBatch::draw(target, shape, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1061,7 +1135,7 @@ namespace tgui
             sf::RectangleShape border;
             border.setFillColor(color);
             border.setSize({size.x, size.y});
-            target.draw(border, states);
+            VertexBatch::draw(target, border, states);
         }
         else // Draw borders in the normal way
         {
@@ -1088,11 +1162,25 @@ namespace tgui
                 {{borders.getLeft(), borders.getTop()}, color}
             };
 
-            target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            VertexBatch::draw(target, vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::isBatchableWidget() const
+    {
+        return m_batchableWidgetType && (*m_batchableWidgetType == typeid(*this));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::isMouseOnWidgetInsideBounds() const
+    {
+        return m_mouseOnWidgetInsideBoundsType && (*m_mouseOnWidgetInsideBoundsType == typeid(*this));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
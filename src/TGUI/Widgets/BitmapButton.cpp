@@ -35,6 +35,8 @@ namespace tgui
     BitmapButton::BitmapButton()
     {
         m_type = "BitmapButton";
+        m_batchableWidgetType = &typeid(BitmapButton);
+        m_mouseOnWidgetInsideBoundsType = &typeid(BitmapButton);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -67,6 +69,8 @@ namespace tgui
 
     void BitmapButton::setText(const sf::String& text)
     {
+        invalidate();
+
         m_string = text;
         m_text.setString(text);
         m_text.setCharacterSize(m_textSize);
@@ -82,6 +86,8 @@ namespace tgui
 
     void BitmapButton::setImage(const Texture& image)
     {
+        invalidate();
+
         m_glyphTexture = image;
         m_glyphSprite.setTexture(m_glyphTexture);
         updateSize();
@@ -98,6 +104,8 @@ namespace tgui
 
     void BitmapButton::setImageScaling(float relativeHeight)
     {
+        invalidate();
+
         m_relativeGlyphHeight = relativeHeight;
         updateSize();
     }
@@ -242,7 +250,7 @@ namespace tgui
         if (!m_glyphSprite.isSet())
             return;
 
-        if (m_relativeGlyphHeight == 0)
+        if ((m_relativeGlyphHeight == 0) || (m_glyphTexture.getImageSize().y == 0))
             m_glyphSprite.setSize(m_glyphTexture.getImageSize());
         else
             m_glyphSprite.setSize({m_relativeGlyphHeight * getInnerSize().y,
@@ -97,6 +97,8 @@ namespace tgui
 
             m_widgets.insert(m_widgets.begin() + index, widget);
             m_widgetNames.insert(m_widgetNames.begin() + index, widgetName);
+            m_spatialIndexNeedsUpdate = true;
+            m_widgetNameIndexNeedsUpdate = true;
         }
         else // Just add the widget to the back
             Group::add(widget, widgetName);
@@ -142,23 +144,33 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BoxLayout::rendererChanged(const std::string& property)
+    void BoxLayout::rendererChanged(PropertyId property)
     {
-        if (property == "spacebetweenwidgets")
+        switch (property.getId())
         {
-            m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
-            updateWidgets();
+            case Property::SpaceBetweenWidgets:
+            {
+                m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
+                updateWidgets();
+                break;
+            }
+
+            case Property::Padding:
+            {
+                Group::rendererChanged(property);
+
+                // Update the space between widgets as the padding is used when no space was explicitly set
+                m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
+                updateWidgets();
+                break;
+            }
+
+            default:
+            {
+                Group::rendererChanged(property);
+                break;
+            }
         }
-        else if (property == "padding")
-        {
-            Group::rendererChanged(property);
-
-            // Update the space between widgets as the padding is used when no space was explicitly set
-            m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
-            updateWidgets();
-        }
-        else
-            Group::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +34,8 @@ namespace tgui
     Button::Button()
     {
         m_type = "Button";
+        m_batchableWidgetType = &typeid(Button);
+        m_mouseOnWidgetInsideBoundsType = &typeid(Button);
         m_text.setFont(m_fontCached);
 
         m_renderer = aurora::makeCopied<ButtonRenderer>();
@@ -122,6 +124,8 @@ namespace tgui
 
     void Button::setText(const sf::String& text)
     {
+        invalidate();
+
         m_string = text;
         m_text.setString(text);
 
@@ -260,100 +264,151 @@ namespace tgui
 
     Signal& Button::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onPress.getName()))
-            return onPress;
+        static const auto signalMap = createSignalMap<Button>(*this, {
+                [](Button& widget) -> Signal& { return widget.onPress; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return ClickableWidget::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Button::rendererChanged(const std::string& property)
+    void Button::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            updateSize();
-        }
-        else if ((property == "textcolor") || (property == "textcolorhover") || (property == "textcolordown") || (property == "textcolordisabled")
-              || (property == "textstyle") || (property == "textstylehover") || (property == "textstyledown") || (property == "textstyledisabled"))
-        {
-            updateTextColorAndStyle();
-        }
-        else if (property == "texture")
-        {
-            m_sprite.setTexture(getSharedRenderer()->getTexture());
-        }
-        else if (property == "texturehover")
-        {
-            m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
-        }
-        else if (property == "texturedown")
-        {
-            m_spriteDown.setTexture(getSharedRenderer()->getTextureDown());
-        }
-        else if (property == "texturedisabled")
-        {
-            m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
-        }
-        else if (property == "texturefocused")
-        {
-            m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
-            m_allowFocus = m_spriteFocused.isSet();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "bordercolorhover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == "bordercolordown")
-        {
-            m_borderColorDownCached = getSharedRenderer()->getBorderColorDown();
-        }
-        else if (property == "bordercolordisabled")
+        switch (property.getId())
         {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "backgroundcolordown")
-        {
-            m_backgroundColorDownCached = getSharedRenderer()->getBackgroundColorDown();
-        }
-        else if (property == "backgroundcolordisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                updateSize();
+                break;
+            }
 
-            m_sprite.setOpacity(m_opacityCached);
-            m_spriteHover.setOpacity(m_opacityCached);
-            m_spriteDown.setOpacity(m_opacityCached);
-            m_spriteDisabled.setOpacity(m_opacityCached);
-            m_spriteFocused.setOpacity(m_opacityCached);
+            case Property::TextColor:
+            case Property::TextColorHover:
+            case Property::TextColorDown:
+            case Property::TextColorDisabled:
+            case Property::TextStyle:
+            case Property::TextStyleHover:
+            case Property::TextStyleDown:
+            case Property::TextStyleDisabled:
+            {
+                updateTextColorAndStyle();
+                break;
+            }
 
-            m_text.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+            case Property::Texture:
+            {
+                m_sprite.setTexture(getSharedRenderer()->getTexture());
+                break;
+            }
 
-            m_text.setFont(m_fontCached);
-            setText(getText());
+            case Property::TextureHover:
+            {
+                m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
+                break;
+            }
+
+            case Property::TextureDown:
+            {
+                m_spriteDown.setTexture(getSharedRenderer()->getTextureDown());
+                break;
+            }
+
+            case Property::TextureDisabled:
+            {
+                m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
+                break;
+            }
+
+            case Property::TextureFocused:
+            {
+                m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
+                m_allowFocus = m_spriteFocused.isSet();
+                break;
+            }
+
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case Property::BorderColorHover:
+            {
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+            }
+
+            case Property::BorderColorDown:
+            {
+                m_borderColorDownCached = getSharedRenderer()->getBorderColorDown();
+                break;
+            }
+
+            case Property::BorderColorDisabled:
+            {
+                m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+                break;
+            }
+
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case Property::BackgroundColorHover:
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+
+            case Property::BackgroundColorDown:
+            {
+                m_backgroundColorDownCached = getSharedRenderer()->getBackgroundColorDown();
+                break;
+            }
+
+            case Property::BackgroundColorDisabled:
+            {
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+            }
+
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                m_sprite.setOpacity(m_opacityCached);
+                m_spriteHover.setOpacity(m_opacityCached);
+                m_spriteDown.setOpacity(m_opacityCached);
+                m_spriteDisabled.setOpacity(m_opacityCached);
+                m_spriteFocused.setOpacity(m_opacityCached);
+
+                m_text.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
+
+                m_text.setFont(m_fontCached);
+                setText(getText());
+                break;
+            }
+
+            default:
+            {
+                Widget::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
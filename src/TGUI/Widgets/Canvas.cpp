@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Canvas.hpp>
+#include <TGUI/VertexBatch.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,6 +35,8 @@ namespace tgui
     Canvas::Canvas(const Layout2d& size)
     {
         m_type = "Canvas";
+        m_batchableWidgetType = &typeid(Canvas);
+        m_mouseOnWidgetInsideBoundsType = &typeid(Canvas);
 
         setSize(size);
     }
@@ -120,6 +123,8 @@ namespace tgui
 
     void Canvas::clear(Color color)
     {
+        invalidate();
+
         m_renderTexture.clear(color);
     }
 
@@ -141,16 +146,18 @@ namespace tgui
 
     void Canvas::display()
     {
+        invalidate();
+
         m_renderTexture.display();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Canvas::rendererChanged(const std::string& property)
+    void Canvas::rendererChanged(PropertyId property)
     {
         Widget::rendererChanged(property);
 
-        if (property == "opacity")
+        if (property == Property::Opacity)
             m_sprite.setColor(Color::calcColorOpacity(Color::White, getSharedRenderer()->getOpacity()));
     }
 
@@ -159,7 +166,7 @@ namespace tgui
     void Canvas::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
-        target.draw(m_sprite, states);
+        VertexBatch::draw(target, m_sprite, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,8 @@
 #include <TGUI/Widgets/ChatBox.hpp>
 #include <TGUI/Clipping.hpp>
 
+#include <cmath>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -36,6 +38,8 @@ namespace tgui
     {
         m_type = "ChatBox";
         m_draggableWidget = true;
+        m_batchableWidgetType = &typeid(ChatBox);
+        m_mouseOnWidgetInsideBoundsType = &typeid(ChatBox);
 
         m_renderer = aurora::makeCopied<ChatBoxRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -122,16 +126,59 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text, Color color)
     {
-        // Remove the oldest line if you exceed the maximum
-        if ((m_maxLines > 0) && (m_maxLines == m_lines.size()))
+        insertLine(text, color);
+        recalculateFullTextHeight();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::addLines(const std::vector<sf::String>& lines)
+    {
+        addLines(lines, m_textColor);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::addLines(const std::vector<sf::String>& lines, Color color)
+    {
+        invalidate();
+
+        // Lines that would be removed again because of the line limit don't have to be added
+        std::size_t firstLineIndex = 0;
+        if ((m_maxLines > 0) && (lines.size() > m_maxLines))
+            firstLineIndex = lines.size() - m_maxLines;
+
+        for (std::size_t i = firstLineIndex; i < lines.size(); ++i)
+            insertLine(lines[i], color);
+
+        recalculateFullTextHeight();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::insertLine(const sf::String& text, Color color)
+    {
+        invalidate();
+
+        // When the maximum is reached, the oldest line is removed and its objects are reused for the new line
+        Line line;
+        const bool lineRemoved = (m_maxLines > 0) && (m_maxLines <= m_lines.size());
+        if (lineRemoved)
         {
             if (m_newLinesBelowOthers)
-                removeLine(0);
+            {
+                line = std::move(m_lines.front());
+                m_lines.pop_front();
+            }
             else
-                removeLine(m_maxLines-1);
+            {
+                line = std::move(m_lines.back());
+                m_lines.pop_back();
+            }
+
+            line.top = 0;
         }
 
-        Line line;
         line.string = text;
         line.text.setColor(color);
         line.text.setOpacity(m_opacityCached);
@@ -142,11 +189,24 @@ namespace tgui
         recalculateLineText(line);
 
         if (m_newLinesBelowOthers)
+        {
+            if (!m_lines.empty())
+                line.top = m_lines.back().top + m_lines.back().text.getSize().y;
+
             m_lines.push_back(std::move(line));
+        }
         else
+        {
+            if (!m_lines.empty())
+                line.top = m_lines.front().top - line.text.getSize().y;
+
             m_lines.push_front(std::move(line));
+        }
 
-        recalculateFullTextHeight();
+        // The positions keep moving away from 0 while old lines are being removed. They are moved back once they lie further
+        // away than the height of all lines together, so that they don't lose precision when lines are added for a long time.
+        if (lineRemoved && (std::abs(m_lines.front().top) > m_fullTextHeight))
+            recalculateLineTops(0);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -177,10 +237,16 @@ namespace tgui
 
     bool ChatBox::removeLine(std::size_t lineIndex)
     {
+        invalidate();
+
         if (lineIndex < m_lines.size())
         {
             m_lines.erase(m_lines.begin() + lineIndex);
 
+            // Removing the first or last line doesn't change the positions of the other lines relative to each other
+            if ((lineIndex > 0) && (lineIndex < m_lines.size()))
+                recalculateLineTops(lineIndex);
+
             recalculateFullTextHeight();
             return true;
         }
@@ -192,6 +258,8 @@ namespace tgui
 
     void ChatBox::removeAllLines()
     {
+        invalidate();
+
         m_lines.clear();
 
         recalculateFullTextHeight();
@@ -208,6 +276,8 @@ namespace tgui
 
     void ChatBox::setLineLimit(std::size_t maxLines)
     {
+        invalidate();
+
         m_maxLines = maxLines;
 
         // Remove the oldest lines if there are too many lines
@@ -233,6 +303,8 @@ namespace tgui
 
     void ChatBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         m_textSize = size;
         m_scroll.setScrollAmount(size);
 
@@ -267,6 +339,8 @@ namespace tgui
 
     void ChatBox::setLinesStartFromTop(bool startFromTop)
     {
+        invalidate();
+
         if (m_linesStartFromTop != startFromTop)
             m_linesStartFromTop = startFromTop;
     }
@@ -282,6 +356,8 @@ namespace tgui
 
     void ChatBox::setNewLinesBelowOthers(bool newLinesBelowOthers)
     {
+        invalidate();
+
         m_newLinesBelowOthers = newLinesBelowOthers;
     }
 
@@ -378,16 +454,31 @@ namespace tgui
         for (auto& line : m_lines)
             recalculateLineText(line);
 
+        recalculateLineTops(0);
         recalculateFullTextHeight();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ChatBox::recalculateLineTops(std::size_t firstLineIndex)
+    {
+        for (std::size_t i = firstLineIndex; i < m_lines.size(); ++i)
+        {
+            if (i > 0)
+                m_lines[i].top = m_lines[i-1].top + m_lines[i-1].text.getSize().y;
+            else
+                m_lines[i].top = 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::recalculateFullTextHeight()
     {
-        m_fullTextHeight = 0;
-        for (const auto& line : m_lines)
-            m_fullTextHeight += line.text.getSize().y;
+        if (!m_lines.empty())
+            m_fullTextHeight = m_lines.back().top + m_lines.back().text.getSize().y - m_lines.front().top;
+        else
+            m_fullTextHeight = 0;
 
         // Update the maximum of the scrollbar
         const unsigned int oldMaximum = m_scroll.getMaximum();
@@ -406,55 +497,77 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChatBox::rendererChanged(const std::string& property)
+    void ChatBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "scrollbar")
-        {
-            m_scroll.setRenderer(getSharedRenderer()->getScrollbar());
-        }
-        else if (property == "bordercolor")
+        switch (property.getId())
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_scroll.setInheritedOpacity(m_opacityCached);
+            case Property::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+            }
 
-            for (auto& line : m_lines)
-                line.text.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+            case Property::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
 
-            for (auto& line : m_lines)
-                line.text.setFont(m_fontCached);
+            case Property::Scrollbar:
+            {
+                m_scroll.setRenderer(getSharedRenderer()->getScrollbar());
+                break;
+            }
+
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_scroll.setInheritedOpacity(m_opacityCached);
+
+                for (auto& line : m_lines)
+                    line.text.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
+
+                for (auto& line : m_lines)
+                    line.text.setFont(m_fontCached);
+
+                recalculateAllLines();
+                break;
+            }
 
-            recalculateAllLines();
+            default:
+            {
+                Widget::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -576,10 +689,22 @@ namespace tgui
         if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSize) < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
             states.transform.translate(0, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSize));
 
-        for (const auto& line : m_lines)
+        if (m_lines.empty())
+            return;
+
+        // Only draw the lines that are visible, the first one is found with a binary search on the positions of the lines
+        const float firstTop = m_lines.front().top;
+        const float visibleTop = firstTop + m_scroll.getValue();
+        const float visibleBottom = visibleTop + getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+        auto it = std::upper_bound(m_lines.begin(), m_lines.end(), visibleTop, [](float top, const Line& line){ return top < line.top; });
+        if (it != m_lines.begin())
+            --it;
+
+        states.transform.translate(0, it->top - firstTop);
+        for (; (it != m_lines.end()) && (it->top < visibleBottom); ++it)
         {
-            line.text.draw(target, states);
-            states.transform.translate(0, line.text.getSize().y);
+            it->text.draw(target, states);
+            states.transform.translate(0, it->text.getSize().y);
         }
     }
 
@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/CheckBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/VertexBatch.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <cmath>
 
@@ -37,6 +38,7 @@ namespace tgui
     CheckBox::CheckBox()
     {
         m_type = "CheckBox";
+        m_batchableWidgetType = &typeid(CheckBox);
 
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
 
@@ -111,6 +113,8 @@ namespace tgui
 
     void CheckBox::check()
     {
+        invalidate();
+
         if (!m_checked)
         {
             m_checked = true;
@@ -159,12 +163,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void CheckBox::rendererChanged(const std::string& property)
+    void CheckBox::rendererChanged(PropertyId property)
     {
-        if (property == "textureunchecked")
-            m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
-        else if (property == "texturechecked")
-            m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
+        switch (property.getId())
+        {
+            case Property::TextureUnchecked:
+            {
+                m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
+                break;
+            }
+
+            case Property::TextureChecked:
+            {
+                m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
+                break;
+            }
+        }
 
         RadioButton::rendererChanged(property);
     }
@@ -173,7 +187,8 @@ namespace tgui
 
     void CheckBox::updateTextureSizes()
     {
-        if (m_spriteUnchecked.isSet() && m_spriteChecked.isSet())
+        if (m_spriteUnchecked.isSet() && m_spriteChecked.isSet()
+         && (m_textureUncheckedCached.getImageSize().x > 0) && (m_textureUncheckedCached.getImageSize().y > 0))
         {
             m_spriteUnchecked.setSize(getInnerSize());
             m_spriteChecked.setSize(
@@ -264,7 +279,7 @@ namespace tgui
                     {{rightPoint.x - x, rightPoint.y - y}, checkColor}
                 };
 
-                target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+                VertexBatch::draw(target, vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getTop()});
@@ -51,6 +51,7 @@ namespace tgui
     ChildWindow::ChildWindow(const sf::String& title, unsigned int titleButtons)
     {
         m_type = "ChildWindow";
+        m_batchableWidgetType = &typeid(ChildWindow);
         m_titleText.setFont(m_fontCached);
 
         m_renderer = aurora::makeCopied<ChildWindowRenderer>();
@@ -239,6 +240,7 @@ namespace tgui
     void ChildWindow::setTitle(const sf::String& title)
     {
         m_titleText.setString(title);
+        invalidateTitleBar();
 
         // Reposition the images and text
         setPosition(m_position);
@@ -437,6 +439,8 @@ namespace tgui
         // Check if the mouse is on top of the title bar
         if (FloatRect{0, 0, getSize().x + m_bordersCached.getLeft() + m_bordersCached.getRight(), m_titleBarHeightCached}.contains(pos))
         {
+            invalidateTitleBar();
+
             // Send the mouse press event to the title buttons
             for (auto& button : {m_closeButton, m_maximizeButton, m_minimizeButton})
             {
@@ -492,6 +496,8 @@ namespace tgui
         // Check if the mouse is on top of the title bar
         if (FloatRect{0, 0, getSize().x + m_bordersCached.getLeft() + m_bordersCached.getRight(), m_titleBarHeightCached}.contains(pos))
         {
+            invalidateTitleBar();
+
             // Send the mouse release event to the title buttons
             for (auto& button : {m_closeButton, m_maximizeButton, m_minimizeButton})
             {
@@ -565,6 +571,8 @@ namespace tgui
         // Check if the mouse is on top of the title bar
         else if (FloatRect{0, 0, getSize().x + m_bordersCached.getLeft() + m_bordersCached.getRight(), m_titleBarHeightCached}.contains(pos))
         {
+            invalidateTitleBar();
+
             // Send the hover event to the button inside the title bar
             for (auto& button : {m_closeButton, m_maximizeButton, m_minimizeButton})
             {
@@ -591,6 +599,8 @@ namespace tgui
                     button->mouseNoLongerOnWidget();
             }
 
+            invalidateTitleBar();
+
             // Check if the mouse is on top of the borders
             if ((FloatRect{0, 0, getSize().x + m_bordersCached.getLeft() + m_bordersCached.getRight(), getSize().y + m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached}.contains(pos))
              && (!FloatRect{m_bordersCached.getLeft(), m_titleBarHeightCached + m_bordersCached.getTop(), getSize().x, getSize().y}.contains(pos)))
@@ -617,6 +627,8 @@ namespace tgui
             if (button)
                 button->mouseNoLongerOnWidget();
         }
+
+        invalidateTitleBar();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -630,6 +642,19 @@ namespace tgui
             if (button)
                 button->mouseNoLongerDown();
         }
+
+        invalidateTitleBar();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChildWindow::invalidateTitleBar()
+    {
+        if (m_parent && m_visible)
+        {
+            m_parent->invalidateChildRegion({getPosition().x, getPosition().y,
+                                             getSize().x + m_bordersCached.getLeft() + m_bordersCached.getRight(), m_titleBarHeightCached});
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -643,7 +668,9 @@ namespace tgui
         {
             if (button)
             {
-                if (m_spriteTitleBar.isSet() && (button->getSharedRenderer()->getTexture().getData() != nullptr))
+                // The button size is based on the images, unless they aren't loaded yet
+                if (m_spriteTitleBar.isSet() && (m_spriteTitleBar.getTexture().getImageSize().y > 0)
+                 && (button->getSharedRenderer()->getTexture().getData() != nullptr) && !button->getSharedRenderer()->getTexture().getData()->loading)
                 {
                     button->setSize(button->getSharedRenderer()->getTexture().getImageSize().x * (m_titleBarHeightCached / m_spriteTitleBar.getTexture().getImageSize().y),
                                     button->getSharedRenderer()->getTexture().getImageSize().y * (m_titleBarHeightCached / m_spriteTitleBar.getTexture().getImageSize().y));
@@ -667,133 +694,171 @@ namespace tgui
 
     Signal& ChildWindow::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onMousePress.getName()))
-            return onMousePress;
-        else if (signalName == toLower(onClose.getName()))
-            return onClose;
-        else if (signalName == toLower(onMinimize.getName()))
-            return onMinimize;
-        else if (signalName == toLower(onMaximize.getName()))
-            return onMaximize;
+        static const auto signalMap = createSignalMap<ChildWindow>(*this, {
+                [](ChildWindow& widget) -> Signal& { return widget.onMousePress; },
+                [](ChildWindow& widget) -> Signal& { return widget.onClose; },
+                [](ChildWindow& widget) -> Signal& { return widget.onMinimize; },
+                [](ChildWindow& widget) -> Signal& { return widget.onMaximize; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return Container::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChildWindow::rendererChanged(const std::string& property)
+    void ChildWindow::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        switch (property.getId())
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "titlecolor")
-        {
-            m_titleText.setColor(getSharedRenderer()->getTitleColor());
-        }
-        else if (property == "texturetitlebar")
-        {
-            m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
 
-            // If the title bar height is determined by the texture then update it (note that getTitleBarHeight has a non-trivial implementation)
-            m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
-            if (m_titleBarHeightCached == m_spriteTitleBar.getTexture().getImageSize().y)
+            case Property::TitleColor:
+            {
+                m_titleText.setColor(getSharedRenderer()->getTitleColor());
+                break;
+            }
+
+            case Property::TextureTitleBar:
+            {
+                m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
+
+                // If the title bar height is determined by the texture then update it (note that getTitleBarHeight has a non-trivial implementation)
+                m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
+                if (m_titleBarHeightCached == m_spriteTitleBar.getTexture().getImageSize().y)
+                    updateTitleBarHeight();
+                break;
+            }
+
+            case Property::TitleBarHeight:
+            {
+                m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
                 updateTitleBarHeight();
-        }
-        else if (property == "titlebarheight")
-        {
-            m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
-            updateTitleBarHeight();
-        }
-        else if (property == "distancetoside")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-            setPosition(m_position);
-        }
-        else if (property == "paddingbetweenbuttons")
-        {
-            m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
-            setPosition(m_position);
-        }
-        else if (property == "showtextontitlebuttons")
-        {
-            m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
-            setTitleButtons(m_titleButtons);
-        }
-        else if (property == "closebutton")
-        {
-            if (m_closeButton)
+                break;
+            }
+
+            case Property::DistanceToSide:
             {
-                m_closeButton->setRenderer(getSharedRenderer()->getCloseButton());
-                m_closeButton->setInheritedOpacity(m_opacityCached);
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+                setPosition(m_position);
+                break;
             }
 
-            updateTitleBarHeight();
-        }
-        else if (property == "maximizebutton")
-        {
-            if (m_maximizeButton)
+            case Property::PaddingBetweenButtons:
             {
-                m_maximizeButton->setRenderer(getSharedRenderer()->getMaximizeButton());
-                m_maximizeButton->setInheritedOpacity(m_opacityCached);
+                m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
+                setPosition(m_position);
+                break;
             }
 
-            updateTitleBarHeight();
-        }
-        else if (property == "minimizebutton")
-        {
-            if (m_minimizeButton)
+            case Property::ShowTextOnTitleButtons:
             {
-                m_minimizeButton->setRenderer(getSharedRenderer()->getMinimizeButton());
-                m_minimizeButton->setInheritedOpacity(m_opacityCached);
+                m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
+                setTitleButtons(m_titleButtons);
+                break;
             }
 
-            updateTitleBarHeight();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "titlebarcolor")
-        {
-            m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "opacity")
-        {
-            Container::rendererChanged(property);
+            case Property::CloseButton:
+            {
+                if (m_closeButton)
+                {
+                    m_closeButton->setRenderer(getSharedRenderer()->getCloseButton());
+                    m_closeButton->setInheritedOpacity(m_opacityCached);
+                }
+
+                updateTitleBarHeight();
+                break;
+            }
 
-            for (auto& button : {m_closeButton, m_minimizeButton, m_maximizeButton})
+            case Property::MaximizeButton:
             {
-                if (button)
-                    button->setInheritedOpacity(m_opacityCached);
+                if (m_maximizeButton)
+                {
+                    m_maximizeButton->setRenderer(getSharedRenderer()->getMaximizeButton());
+                    m_maximizeButton->setInheritedOpacity(m_opacityCached);
+                }
+
+                updateTitleBarHeight();
+                break;
             }
 
-            m_titleText.setOpacity(m_opacityCached);
-            m_spriteTitleBar.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Container::rendererChanged(property);
+            case Property::MinimizeButton:
+            {
+                if (m_minimizeButton)
+                {
+                    m_minimizeButton->setRenderer(getSharedRenderer()->getMinimizeButton());
+                    m_minimizeButton->setInheritedOpacity(m_opacityCached);
+                }
+
+                updateTitleBarHeight();
+                break;
+            }
 
-            for (auto& button : {m_closeButton, m_minimizeButton, m_maximizeButton})
+            case Property::BackgroundColor:
             {
-                if (button)
-                    button->setInheritedFont(m_fontCached);
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
             }
 
-            m_titleText.setFont(m_fontCached);
-            if (m_titleTextSize == 0)
-                m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, getSharedRenderer()->getTitleBarHeight() * 0.8f));
+            case Property::TitleBarColor:
+            {
+                m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
+                break;
+            }
 
-            setPosition(m_position);
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case Property::Opacity:
+            {
+                Container::rendererChanged(property);
+
+                for (auto& button : {m_closeButton, m_minimizeButton, m_maximizeButton})
+                {
+                    if (button)
+                        button->setInheritedOpacity(m_opacityCached);
+                }
+
+                m_titleText.setOpacity(m_opacityCached);
+                m_spriteTitleBar.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case Property::Font:
+            {
+                Container::rendererChanged(property);
+
+                for (auto& button : {m_closeButton, m_minimizeButton, m_maximizeButton})
+                {
+                    if (button)
+                        button->setInheritedFont(m_fontCached);
+                }
+
+                m_titleText.setFont(m_fontCached);
+                if (m_titleTextSize == 0)
+                    m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, getSharedRenderer()->getTitleBarHeight() * 0.8f));
+
+                setPosition(m_position);
+                break;
+            }
+
+            default:
+            {
+                Container::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Container::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +34,8 @@ namespace tgui
     ClickableWidget::ClickableWidget()
     {
         m_type = "ClickableWidget";
+        m_batchableWidgetType = &typeid(ClickableWidget);
+        m_mouseOnWidgetInsideBoundsType = &typeid(ClickableWidget);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -92,12 +94,15 @@ namespace tgui
 
     Signal& ClickableWidget::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onMousePress.getName()))
-            return onMousePress;
-        else if (signalName == toLower(onMouseRelease.getName()))
-            return onMouseRelease;
-        else if (signalName == toLower(onClick.getName()))
-            return onClick;
+        static const auto signalMap = createSignalMap<ClickableWidget>(*this, {
+                [](ClickableWidget& widget) -> Signal& { return widget.onMousePress; },
+                [](ClickableWidget& widget) -> Signal& { return widget.onMouseRelease; },
+                [](ClickableWidget& widget) -> Signal& { return widget.onClick; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return Widget::getSignal(std::move(signalName));
     }
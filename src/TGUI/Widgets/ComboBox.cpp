@@ -26,6 +26,7 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Widgets/ComboBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/VertexBatch.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 #include <TGUI/SignalImpl.hpp>
 
@@ -39,6 +40,8 @@ namespace tgui
     {
         m_type = "ComboBox";
         m_draggableWidget = true;
+        m_batchableWidgetType = &typeid(ComboBox);
+        m_mouseOnWidgetInsideBoundsType = &typeid(ComboBox);
         m_text.setFont(m_fontCached);
 
         initListBox();
@@ -221,7 +224,7 @@ namespace tgui
             updateListBoxHeight();
         }
 
-        if (m_spriteArrow.isSet())
+        if (m_spriteArrow.isSet() && (m_spriteArrow.getTexture().getImageSize().y > 0))
         {
             m_spriteArrow.setSize({m_spriteArrow.getTexture().getImageSize().x * (height / m_spriteArrow.getTexture().getImageSize().y), height});
             m_spriteArrowHover.setSize(m_spriteArrow.getSize());
@@ -234,6 +237,8 @@ namespace tgui
 
     void ComboBox::setItemsToDisplay(std::size_t nrOfItemsInList)
     {
+        invalidate();
+
         m_nrOfItemsToDisplay = nrOfItemsInList;
 
         if (m_nrOfItemsToDisplay < m_listBox->getItemCount())
@@ -258,6 +263,8 @@ namespace tgui
 
     bool ComboBox::addItem(const sf::String& item, const sf::String& id)
     {
+        invalidate();
+
         const bool ret = m_listBox->addItem(item, id);
         updateListBoxHeight();
         return ret;
@@ -265,8 +272,33 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t ComboBox::addItems(const std::vector<sf::String>& itemNames, const std::vector<sf::String>& ids)
+    {
+        invalidate();
+
+        const std::size_t count = m_listBox->addItems(itemNames, ids);
+        updateListBoxHeight();
+        return count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ComboBox::setItems(const std::vector<sf::String>& itemNames, const std::vector<sf::String>& ids)
+    {
+        invalidate();
+
+        m_text.setString("");
+        const std::size_t count = m_listBox->setItems(itemNames, ids);
+        updateListBoxHeight();
+        return count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ComboBox::setSelectedItem(const sf::String& itemName)
     {
+        invalidate();
+
         const bool ret = m_listBox->setSelectedItem(itemName);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -276,6 +308,8 @@ namespace tgui
 
     bool ComboBox::setSelectedItemById(const sf::String& id)
     {
+        invalidate();
+
         const bool ret = m_listBox->setSelectedItemById(id);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -285,6 +319,8 @@ namespace tgui
 
     bool ComboBox::setSelectedItemByIndex(std::size_t index)
     {
+        invalidate();
+
         const bool ret = m_listBox->setSelectedItemByIndex(index);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -294,6 +330,8 @@ namespace tgui
 
     void ComboBox::deselectItem()
     {
+        invalidate();
+
         m_text.setString("");
         m_listBox->deselectItem();
     }
@@ -302,6 +340,8 @@ namespace tgui
 
     bool ComboBox::removeItem(const sf::String& itemName)
     {
+        invalidate();
+
         // Implemented like removeItemByIndex instead of like removeItemById because m_listBox->getItems() may be slow
 
         const bool ret = m_listBox->removeItem(itemName);
@@ -319,20 +359,25 @@ namespace tgui
 
     bool ComboBox::removeItemById(const sf::String& id)
     {
-        const auto& ids = m_listBox->getItemIds();
-        for (std::size_t i = 0; i < ids.size(); ++i)
-        {
-            if (ids[i] == id)
-                return removeItemByIndex(i);
-        }
+        invalidate();
+
+        const bool ret = m_listBox->removeItemById(id);
+
+        m_text.setString(m_listBox->getSelectedItem());
+
+        // Shrink the list size
+        if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
+            updateListBoxHeight();
 
-        return false;
+        return ret;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ComboBox::removeItemByIndex(std::size_t index)
     {
+        invalidate();
+
         const bool ret = m_listBox->removeItemByIndex(index);
 
         m_text.setString(m_listBox->getSelectedItem());
@@ -348,6 +393,8 @@ namespace tgui
 
     void ComboBox::removeAllItems()
     {
+        invalidate();
+
         m_text.setString("");
         m_listBox->removeAllItems();
 
@@ -386,6 +433,8 @@ namespace tgui
 
     bool ComboBox::changeItem(const sf::String& originalValue, const sf::String& newValue)
     {
+        invalidate();
+
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -395,6 +444,8 @@ namespace tgui
 
     bool ComboBox::changeItemById(const sf::String& id, const sf::String& newValue)
     {
+        invalidate();
+
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -404,6 +455,8 @@ namespace tgui
 
     bool ComboBox::changeItemByIndex(std::size_t index, const sf::String& newValue)
     {
+        invalidate();
+
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -427,6 +480,8 @@ namespace tgui
 
     void ComboBox::setMaximumItems(std::size_t maximumItems)
     {
+        invalidate();
+
         m_listBox->setMaximumItems(maximumItems);
     }
 
@@ -441,6 +496,8 @@ namespace tgui
 
     void ComboBox::setTextSize(unsigned int textSize)
     {
+        invalidate();
+
         m_listBox->setTextSize(textSize);
         m_text.setCharacterSize(m_listBox->getTextSize());
     }
@@ -456,6 +513,8 @@ namespace tgui
 
     void ComboBox::setExpandDirection(ExpandDirection direction)
     {
+        invalidate();
+
         m_expandDirection = direction;
     }
 
@@ -550,96 +609,139 @@ namespace tgui
 
     Signal& ComboBox::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onItemSelect.getName()))
-            return onItemSelect;
+        static const auto signalMap = createSignalMap<ComboBox>(*this, {
+                [](ComboBox& widget) -> Signal& { return widget.onItemSelect; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return Widget::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ComboBox::rendererChanged(const std::string& property)
+    void ComboBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "textcolor")
-        {
-            m_text.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "textstyle")
+        switch (property.getId())
         {
-            m_text.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "texturearrow")
-        {
-            m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
-            setSize(m_size);
-        }
-        else if (property == "texturearrowhover")
-        {
-            m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
-        }
-        else if (property == "listbox")
-        {
-            m_listBox->setRenderer(getSharedRenderer()->getListBox());
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "arrowbackgroundcolor")
-        {
-            m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
-        }
-        else if (property == "arrowbackgroundcolorhover")
-        {
-            m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
-        }
-        else if (property == "arrowcolor")
-        {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
-        }
-        else if (property == "arrowcolorhover")
-        {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteArrow.setOpacity(m_opacityCached);
-            m_spriteArrowHover.setOpacity(m_opacityCached);
+            case Property::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+            }
 
-            m_text.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+            case Property::TextColor:
+            {
+                m_text.setColor(getSharedRenderer()->getTextColor());
+                break;
+            }
+
+            case Property::TextStyle:
+            {
+                m_text.setStyle(getSharedRenderer()->getTextStyle());
+                break;
+            }
+
+            case Property::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+
+            case Property::TextureArrow:
+            {
+                m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
+                setSize(m_size);
+                break;
+            }
+
+            case Property::TextureArrowHover:
+            {
+                m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
+                break;
+            }
+
+            case Property::ListBox:
+            {
+                m_listBox->setRenderer(getSharedRenderer()->getListBox());
+                break;
+            }
+
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case Property::ArrowBackgroundColor:
+            {
+                m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
+                break;
+            }
 
-            m_text.setFont(m_fontCached);
-            m_listBox->setInheritedFont(m_fontCached);
+            case Property::ArrowBackgroundColorHover:
+            {
+                m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
+                break;
+            }
+
+            case Property::ArrowColor:
+            {
+                m_arrowColorCached = getSharedRenderer()->getArrowColor();
+                break;
+            }
+
+            case Property::ArrowColorHover:
+            {
+                m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+                break;
+            }
 
-            setSize(m_size);
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteArrow.setOpacity(m_opacityCached);
+                m_spriteArrowHover.setOpacity(m_opacityCached);
+
+                m_text.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
+
+                m_text.setFont(m_fontCached);
+                m_listBox->setInheritedFont(m_fontCached);
+
+                setSize(m_size);
+                break;
+            }
+
+            default:
+            {
+                Widget::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -701,16 +803,26 @@ namespace tgui
                 if (node->propertyValuePairs["items"]->valueList.size() != node->propertyValuePairs["itemids"]->valueList.size())
                     throw Exception{"Amounts of values for 'Items' differs from the amount in 'ItemIds'"};
 
+                std::vector<sf::String> items;
+                std::vector<sf::String> ids;
+                items.reserve(node->propertyValuePairs["items"]->valueList.size());
+                ids.reserve(node->propertyValuePairs["itemids"]->valueList.size());
                 for (std::size_t i = 0; i < node->propertyValuePairs["items"]->valueList.size(); ++i)
                 {
-                    addItem(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["items"]->valueList[i]).getString(),
-                            Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["itemids"]->valueList[i]).getString());
+                    items.push_back(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["items"]->valueList[i]).getString());
+                    ids.push_back(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["itemids"]->valueList[i]).getString());
                 }
+
+                addItems(items, ids);
             }
             else // There are no item ids
             {
+                std::vector<sf::String> items;
+                items.reserve(node->propertyValuePairs["items"]->valueList.size());
                 for (const auto& item : node->propertyValuePairs["items"]->valueList)
-                    addItem(Deserializer::deserialize(ObjectConverter::Type::String, item).getString());
+                    items.push_back(Deserializer::deserialize(ObjectConverter::Type::String, item).getString());
+
+                addItems(items);
             }
         }
         else // If there are no items, there should be no item ids
@@ -882,7 +994,7 @@ namespace tgui
             else
                 arrow.setFillColor(m_arrowColorCached);
 
-            target.draw(arrow, states);
+            VertexBatch::draw(target, arrow, states);
         }
 
         // Draw the selected item
@@ -48,6 +48,8 @@ namespace tgui
     EditBox::EditBox()
     {
         m_type = "EditBox";
+        m_batchableWidgetType = &typeid(EditBox);
+        m_mouseOnWidgetInsideBoundsType = &typeid(EditBox);
         m_textBeforeSelection.setFont(m_fontCached);
         m_textSelection.setFont(m_fontCached);
         m_textAfterSelection.setFont(m_fontCached);
@@ -162,6 +164,9 @@ namespace tgui
 
     void EditBox::setText(const sf::String& text)
     {
+        invalidate();
+        m_characterOffsets.clear();
+
         // Check if the text is auto sized
         if (m_textSize == 0)
         {
@@ -257,6 +262,8 @@ namespace tgui
 
     void EditBox::setDefaultText(const sf::String& text)
     {
+        invalidate();
+
         m_defaultText.setString(text);
     }
 
@@ -271,6 +278,8 @@ namespace tgui
 
     void EditBox::selectText(std::size_t start, std::size_t length)
     {
+        invalidate();
+
         m_selStart = start;
         m_selEnd = std::min(m_text.getSize(), start + length);
         updateSelection();
@@ -323,6 +332,9 @@ namespace tgui
 
     void EditBox::setMaximumCharacters(unsigned int maxChars)
     {
+        invalidate();
+        m_characterOffsets.clear();
+
         // Set the new character limit ( 0 to disable the limit )
         m_maxChars = maxChars;
 
@@ -372,6 +384,9 @@ namespace tgui
 
     void EditBox::limitTextWidth(bool limitWidth)
     {
+        invalidate();
+        m_characterOffsets.clear();
+
         m_limitTextWidth = limitWidth;
 
         if (!m_fontCached)
@@ -412,6 +427,8 @@ namespace tgui
 
     void EditBox::setReadOnly(bool readOnly)
     {
+        invalidate();
+
         m_readOnly = readOnly;
     }
 
@@ -426,6 +443,8 @@ namespace tgui
 
     void EditBox::setCaretPosition(std::size_t charactersBeforeCaret)
     {
+        invalidate();
+
         // The caret position has to stay inside the string
         if (charactersBeforeCaret > m_text.getSize())
             charactersBeforeCaret = m_text.getSize();
@@ -724,6 +743,7 @@ namespace tgui
                     displayedString.erase(m_selEnd-1, 1);
                     m_textFull.setString(displayedString);
                     m_text.erase(m_selEnd-1, 1);
+                    m_characterOffsets.clear();
 
                     // Set the caret back on the correct position
                     setCaretPosition(m_selEnd - 1);
@@ -763,6 +783,7 @@ namespace tgui
                     displayedString.erase(m_selEnd, 1);
                     m_textFull.setString(displayedString);
                     m_text.erase(m_selEnd, 1);
+                    m_characterOffsets.clear();
 
                     // Set the caret back on the correct position
                     setCaretPosition(m_selEnd);
@@ -886,6 +907,7 @@ namespace tgui
 
         // Insert our character
         m_text.insert(m_selEnd, key);
+        m_characterOffsets.clear();
 
         // Change the displayed text
         sf::String displayedText = m_textFull.getString();
@@ -953,156 +975,215 @@ namespace tgui
 
     Signal& EditBox::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onTextChange.getName()))
-            return onTextChange;
-        else if (signalName == toLower(onReturnKeyPress.getName()))
-            return onReturnKeyPress;
+        static const auto signalMap = createSignalMap<EditBox>(*this, {
+                [](EditBox& widget) -> Signal& { return widget.onTextChange; },
+                [](EditBox& widget) -> Signal& { return widget.onReturnKeyPress; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return ClickableWidget::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void EditBox::rendererChanged(const std::string& property)
+    void EditBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
+        switch (property.getId())
         {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            m_paddingCached.updateParentSize(getSize());
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
 
-            setText(m_text);
+            case Property::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                m_paddingCached.updateParentSize(getSize());
 
-            m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
-        }
-        else if (property == "caretwidth")
-        {
-            m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
-            m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
-        }
-        else if ((property == "textcolor") || (property == "textcolordisabled"))
-        {
-            if (m_enabled || !getSharedRenderer()->getTextColorDisabled().isSet())
+                setText(m_text);
+
+                m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
+                break;
+            }
+
+            case Property::CaretWidth:
             {
-                m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
-                m_textAfterSelection.setColor(getSharedRenderer()->getTextColor());
+                m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
+                m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
+                break;
             }
-            else
+
+            case Property::TextColor:
+            case Property::TextColorDisabled:
             {
-                m_textBeforeSelection.setColor(getSharedRenderer()->getTextColorDisabled());
-                m_textAfterSelection.setColor(getSharedRenderer()->getTextColorDisabled());
+                if (m_enabled || !getSharedRenderer()->getTextColorDisabled().isSet())
+                {
+                    m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
+                    m_textAfterSelection.setColor(getSharedRenderer()->getTextColor());
+                }
+                else
+                {
+                    m_textBeforeSelection.setColor(getSharedRenderer()->getTextColorDisabled());
+                    m_textAfterSelection.setColor(getSharedRenderer()->getTextColorDisabled());
+                }
+                break;
             }
-        }
-        else if (property == "selectedtextcolor")
-        {
-            m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
-        }
-        else if (property == "defaulttextcolor")
-        {
-            m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
-        }
-        else if (property == "texture")
-        {
-            m_sprite.setTexture(getSharedRenderer()->getTexture());
-        }
-        else if (property == "texturehover")
-        {
-            m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
-        }
-        else if (property == "texturedisabled")
-        {
-            m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
-        }
-        else if (property == "texturefocused")
-        {
-            m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
-            m_allowFocus = m_spriteFocused.isSet();
-        }
-        else if (property == "textstyle")
-        {
-            const TextStyle style = getSharedRenderer()->getTextStyle();
-            m_textBeforeSelection.setStyle(style);
-            m_textAfterSelection.setStyle(style);
-            m_textSelection.setStyle(style);
-            m_textFull.setStyle(style);
-        }
-        else if (property == "defaulttextstyle")
-        {
-            m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "bordercolorhover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == "bordercolordisabled")
-        {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "backgroundcolordisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == "caretcolor")
-        {
-            m_caretColorCached = getSharedRenderer()->getCaretColor();
-        }
-        else if (property == "caretcolorhover")
-        {
-            m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
-        }
-        else if (property == "caretcolordisabled")
-        {
-            m_caretColorDisabledCached = getSharedRenderer()->getCaretColorDisabled();
-        }
-        else if (property == "selectedtextbackgroundcolor")
-        {
-            m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
 
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection.setOpacity(m_opacityCached);
-            m_textSelection.setOpacity(m_opacityCached);
-            m_defaultText.setOpacity(m_opacityCached);
+            case Property::SelectedTextColor:
+            {
+                m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
+                break;
+            }
 
-            m_sprite.setOpacity(m_opacityCached);
-            m_spriteHover.setOpacity(m_opacityCached);
-            m_spriteDisabled.setOpacity(m_opacityCached);
-            m_spriteFocused.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+            case Property::DefaultTextColor:
+            {
+                m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
+                break;
+            }
+
+            case Property::Texture:
+            {
+                m_sprite.setTexture(getSharedRenderer()->getTexture());
+                break;
+            }
 
-            m_textBeforeSelection.setFont(m_fontCached);
-            m_textSelection.setFont(m_fontCached);
-            m_textAfterSelection.setFont(m_fontCached);
-            m_textFull.setFont(m_fontCached);
-            m_defaultText.setFont(m_fontCached);
+            case Property::TextureHover:
+            {
+                m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
+                break;
+            }
 
-            // Recalculate the text size and position
-            setText(m_text);
+            case Property::TextureDisabled:
+            {
+                m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
+                break;
+            }
+
+            case Property::TextureFocused:
+            {
+                m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
+                m_allowFocus = m_spriteFocused.isSet();
+                break;
+            }
+
+            case Property::TextStyle:
+            {
+                const TextStyle style = getSharedRenderer()->getTextStyle();
+                m_textBeforeSelection.setStyle(style);
+                m_textAfterSelection.setStyle(style);
+                m_textSelection.setStyle(style);
+                m_textFull.setStyle(style);
+                break;
+            }
+
+            case Property::DefaultTextStyle:
+            {
+                m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
+                break;
+            }
+
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case Property::BorderColorHover:
+            {
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+            }
+
+            case Property::BorderColorDisabled:
+            {
+                m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+                break;
+            }
+
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case Property::BackgroundColorHover:
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+
+            case Property::BackgroundColorDisabled:
+            {
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+            }
+
+            case Property::CaretColor:
+            {
+                m_caretColorCached = getSharedRenderer()->getCaretColor();
+                break;
+            }
+
+            case Property::CaretColorHover:
+            {
+                m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
+                break;
+            }
+
+            case Property::CaretColorDisabled:
+            {
+                m_caretColorDisabledCached = getSharedRenderer()->getCaretColorDisabled();
+                break;
+            }
+
+            case Property::SelectedTextBackgroundColor:
+            {
+                m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
+                break;
+            }
+
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                m_textBeforeSelection.setOpacity(m_opacityCached);
+                m_textAfterSelection.setOpacity(m_opacityCached);
+                m_textSelection.setOpacity(m_opacityCached);
+                m_defaultText.setOpacity(m_opacityCached);
+
+                m_sprite.setOpacity(m_opacityCached);
+                m_spriteHover.setOpacity(m_opacityCached);
+                m_spriteDisabled.setOpacity(m_opacityCached);
+                m_spriteFocused.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
+
+                m_textBeforeSelection.setFont(m_fontCached);
+                m_textSelection.setFont(m_fontCached);
+                m_textAfterSelection.setFont(m_fontCached);
+                m_textFull.setFont(m_fontCached);
+                m_defaultText.setFont(m_fontCached);
+
+                // Recalculate the text size and position
+                setText(m_text);
+                break;
+            }
+
+            default:
+            {
+                Widget::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1239,41 +1320,38 @@ namespace tgui
             }
         }
 
-        float width = 0;
-        std::uint32_t prevChar = 0;
-        const unsigned int textSize = getTextSize();
         const bool bold = (m_textFull.getStyle() & sf::Text::Bold) != 0;
+        const auto metrics = GlyphMetrics::get(m_fontCached, getTextSize(), bold);
+        if (!metrics)
+            return 0;
 
-        std::size_t index;
-        for (index = 0; index < m_text.getSize(); ++index)
+        if (m_characterOffsets.empty() || (metrics != m_characterOffsetsMetrics))
         {
-            float charWidth;
-            std::uint32_t curChar = m_text[index];
-            if (curChar == '\n')
-            {
-                // This should not happen as edit box is for single line text, but lets try the next line anyway since we haven't found the position yet
-                width = 0;
-                prevChar = 0;
-                continue;
-            }
-            else if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', textSize, bold).advance) * 4;
-            else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, textSize, bold).advance);
+            metrics->getCharacterOffsets(m_text, m_characterOffsets);
+            m_characterOffsetsMetrics = metrics;
+        }
 
-            const float kerning = static_cast<float>(m_fontCached.getKerning(prevChar, curChar, textSize));
-            if (width + charWidth < posX)
-                width += charWidth + kerning;
-            else
+        // Search for the first character of which the right side is past the mouse
+        std::size_t index = 0;
+        std::size_t count = m_text.getSize();
+        while (count > 0)
+        {
+            const std::size_t step = count / 2;
+            if (m_characterOffsets[index + step] + metrics->getAdvance(m_text[index + step]) < posX)
             {
-                // If the mouse is on the second halve of the character then the caret should be on the right of it
-                if (width + charWidth - posX < charWidth / 2.f)
-                    index++;
-
-                break;
+                index += step + 1;
+                count -= step + 1;
             }
+            else
+                count = step;
+        }
 
-            prevChar = curChar;
+        // If the mouse is on the second halve of the character then the caret should be on the right of it
+        if (index < m_text.getSize())
+        {
+            const float charWidth = metrics->getAdvance(m_text[index]);
+            if (m_characterOffsets[index] + charWidth - posX < charWidth / 2.f)
+                index++;
         }
 
         return index;
@@ -1294,6 +1372,7 @@ namespace tgui
         displayedString.erase(pos, m_selChars);
         m_textFull.setString(displayedString);
         m_text.erase(pos, m_selChars);
+        m_characterOffsets.clear();
 
         // Set the caret back on the correct position
         setCaretPosition(pos);
@@ -1444,6 +1523,10 @@ namespace tgui
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
 
+            // The caret is only drawn when the widget is focused
+            if (m_focused)
+                invalidate();
+
             // Too slow for double clicking
             m_possibleDoubleClick = false;
         }
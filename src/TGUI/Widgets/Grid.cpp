@@ -35,6 +35,8 @@ namespace tgui
     Grid::Grid()
     {
         m_type = "Grid";
+        m_batchableWidgetType = &typeid(Grid);
+        m_mouseOnWidgetInsideBoundsType = &typeid(Grid);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,8 @@ namespace tgui
     Group::Group(const Layout2d& size)
     {
         m_type = "Group";
+        m_batchableWidgetType = &typeid(Group);
+        m_mouseOnWidgetInsideBoundsType = &typeid(Group);
 
         m_renderer = aurora::makeCopied<GroupRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -135,15 +137,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Group::rendererChanged(const std::string& property)
+    void Group::rendererChanged(PropertyId property)
     {
-        if (property == "padding")
+        switch (property.getId())
         {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            case Property::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+            }
+
+            default:
+            {
+                Container::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Container::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -36,6 +36,8 @@ namespace tgui
         BoxLayoutRatios{size}
     {
         m_type = "HorizontalLayout";
+        m_batchableWidgetType = &typeid(HorizontalLayout);
+        m_mouseOnWidgetInsideBoundsType = &typeid(HorizontalLayout);
 
         m_renderer = aurora::makeCopied<BoxLayoutRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -35,6 +35,8 @@ namespace tgui
         BoxLayout{size}
     {
         m_type = "HorizontalWrap";
+        m_batchableWidgetType = &typeid(HorizontalWrap);
+        m_mouseOnWidgetInsideBoundsType = &typeid(HorizontalWrap);
 
         m_renderer = aurora::makeCopied<BoxLayoutRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
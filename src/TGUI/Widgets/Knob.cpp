@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Knob.hpp>
+#include <TGUI/VertexBatch.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 #include <cmath>
 
@@ -44,6 +45,8 @@ namespace tgui
     {
         m_type = "Knob";
         m_draggableWidget = true;
+        m_batchableWidgetType = &typeid(Knob);
+        m_mouseOnWidgetInsideBoundsType = &typeid(Knob);
 
         m_renderer = aurora::makeCopied<KnobRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -104,7 +107,8 @@ namespace tgui
 
         m_bordersCached.updateParentSize(getSize());
 
-        if (m_spriteBackground.isSet() && m_spriteForeground.isSet())
+        if (m_spriteBackground.isSet() && m_spriteForeground.isSet()
+         && (m_spriteBackground.getTexture().getImageSize().x > 0) && (m_spriteBackground.getTexture().getImageSize().y > 0))
         {
             m_spriteBackground.setSize(getInnerSize());
             m_spriteForeground.setSize({m_spriteForeground.getTexture().getImageSize().x / m_spriteBackground.getTexture().getImageSize().x * getInnerSize().x,
@@ -116,6 +120,8 @@ namespace tgui
 
     void Knob::setStartRotation(float startRotation)
     {
+        invalidate();
+
         while (startRotation >= 360)
             startRotation -= 360;
         while (startRotation < 0)
@@ -138,6 +144,8 @@ namespace tgui
 
     void Knob::setEndRotation(float endRotation)
     {
+        invalidate();
+
         while (endRotation >= 360)
             endRotation -= 360;
         while (endRotation < 0)
@@ -160,6 +168,8 @@ namespace tgui
 
     void Knob::setMinimum(int minimum)
     {
+        invalidate();
+
         if (m_minimum != minimum)
         {
             // Set the new minimum
@@ -189,6 +199,8 @@ namespace tgui
 
     void Knob::setMaximum(int maximum)
     {
+        invalidate();
+
         if (m_maximum != maximum)
         {
             // Set the new maximum
@@ -221,6 +233,8 @@ namespace tgui
 
     void Knob::setValue(int value)
     {
+        invalidate();
+
         if (m_value != value)
         {
             // Set the new value
@@ -250,6 +264,8 @@ namespace tgui
 
     void Knob::setClockwiseTurning(bool clockwise)
     {
+        invalidate();
+
         m_clockwiseTurning = clockwise;
 
         // The knob might have to point in a different direction even though it has the same value
@@ -471,56 +487,83 @@ namespace tgui
 
     Signal& Knob::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onValueChange.getName()))
-            return onValueChange;
+        static const auto signalMap = createSignalMap<Knob>(*this, {
+                [](Knob& widget) -> Signal& { return widget.onValueChange; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return Widget::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Knob::rendererChanged(const std::string& property)
+    void Knob::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-            setSize(m_size);
-        }
-        else if (property == "textureforeground")
-        {
-            m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
-            setSize(m_size);
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "thumbcolor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == "imagerotation")
-        {
-            m_imageRotationCached = getSharedRenderer()->getImageRotation();
-        }
-        else if (property == "opacity")
+        switch (property.getId())
         {
-            Widget::rendererChanged(property);
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
+
+            case Property::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                setSize(m_size);
+                break;
+            }
+
+            case Property::TextureForeground:
+            {
+                m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
+                setSize(m_size);
+                break;
+            }
+
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case Property::ThumbColor:
+            {
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                break;
+            }
+
+            case Property::ImageRotation:
+            {
+                m_imageRotationCached = getSharedRenderer()->getImageRotation();
+                break;
+            }
+
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteForeground.setOpacity(m_opacityCached);
+                break;
+            }
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteForeground.setOpacity(m_opacityCached);
+            default:
+            {
+                Widget::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -584,7 +627,7 @@ namespace tgui
             bordersShape.setFillColor(Color::Transparent);
             bordersShape.setOutlineColor(Color::calcColorOpacity(m_borderColorCached, m_opacityCached));
             bordersShape.setOutlineThickness(borderThickness);
-            target.draw(bordersShape, states);
+            VertexBatch::draw(target, bordersShape, states);
         }
 
         // Draw the background
@@ -594,7 +637,7 @@ namespace tgui
         {
             sf::CircleShape background{size / 2};
             background.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
-            target.draw(background, states);
+            VertexBatch::draw(target, background, states);
         }
 
         // Draw the foreground
@@ -616,7 +659,7 @@ namespace tgui
             thumb.setFillColor(Color::calcColorOpacity(m_thumbColorCached, m_opacityCached));
             thumb.setPosition({(size / 2.0f) - thumb.getRadius() + (std::cos(m_angle / 180 * pi) * (size / 2) * 3/5),
                                (size / 2.0f) - thumb.getRadius() + (-std::sin(m_angle / 180 * pi) * (size / 2) * 3/5)});
-            target.draw(thumb, states);
+            VertexBatch::draw(target, thumb, states);
         }
     }
 
@@ -41,6 +41,8 @@ namespace tgui
     Label::Label()
     {
         m_type = "Label";
+        m_batchableWidgetType = &typeid(Label);
+        m_mouseOnWidgetInsideBoundsType = &typeid(Label);
 
         m_renderer = aurora::makeCopied<LabelRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -116,6 +118,8 @@ namespace tgui
 
     void Label::setText(const sf::String& string)
     {
+        invalidate();
+
         m_string = string;
         rearrangeText();
     }
@@ -131,6 +135,8 @@ namespace tgui
 
     void Label::setTextSize(unsigned int size)
     {
+        invalidate();
+
         if (size != m_textSize)
         {
             m_textSize = size;
@@ -149,6 +155,8 @@ namespace tgui
 
     void Label::setHorizontalAlignment(HorizontalAlignment alignment)
     {
+        invalidate();
+
         m_horizontalAlignment = alignment;
         rearrangeText();
     }
@@ -164,6 +172,8 @@ namespace tgui
 
     void Label::setVerticalAlignment(VerticalAlignment alignment)
     {
+        invalidate();
+
         m_verticalAlignment = alignment;
         rearrangeText();
     }
@@ -179,6 +189,8 @@ namespace tgui
 
     void Label::setAutoSize(bool autoSize)
     {
+        invalidate();
+
         if (m_autoSize != autoSize)
         {
             m_autoSize = autoSize;
@@ -197,6 +209,8 @@ namespace tgui
 
     void Label::setMaximumTextWidth(float maximumWidth)
     {
+        invalidate();
+
         if (m_maximumTextWidth != maximumWidth)
         {
             m_maximumTextWidth = maximumWidth;
@@ -265,61 +279,88 @@ namespace tgui
 
     Signal& Label::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
+        static const auto signalMap = createSignalMap<Label>(*this, {
+                [](Label& widget) -> Signal& { return widget.onDoubleClick; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return ClickableWidget::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Label::rendererChanged(const std::string& property)
+    void Label::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            m_bordersCached.updateParentSize(getSize());
-            rearrangeText();
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            m_paddingCached.updateParentSize(getSize());
-            rearrangeText();
-        }
-        else if (property == "textstyle")
+        switch (property.getId())
         {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
-            rearrangeText();
-        }
-        else if (property == "textcolor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            for (auto& line : m_lines)
-                line.setColor(m_textColorCached);
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
-            rearrangeText();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                m_bordersCached.updateParentSize(getSize());
+                rearrangeText();
+                break;
+            }
 
-            for (auto& line : m_lines)
-                line.setOpacity(m_opacityCached);
+            case Property::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                m_paddingCached.updateParentSize(getSize());
+                rearrangeText();
+                break;
+            }
+
+            case Property::TextStyle:
+            {
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
+                rearrangeText();
+                break;
+            }
+
+            case Property::TextColor:
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                for (auto& line : m_lines)
+                    line.setColor(m_textColorCached);
+                break;
+            }
+
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
+                rearrangeText();
+                break;
+            }
+
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                for (auto& line : m_lines)
+                    line.setOpacity(m_opacityCached);
+                break;
+            }
+
+            default:
+            {
+                Widget::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -428,15 +469,16 @@ namespace tgui
         }
 
         // Fit the text in the available space
-        const sf::String string = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSize, m_textStyleCached & sf::Text::Bold);
+        const std::vector<std::size_t> lineBreaks = Text::findLineBreaks(maxWidth, m_string, m_fontCached, m_textSize, m_textStyleCached & sf::Text::Bold);
 
         // Split the string in multiple lines
         float width = 0;
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != sf::String::InvalidPos)
+        for (std::size_t i = 0; i <= lineBreaks.size(); ++i)
         {
-            newLinePos = string.find('\n', searchPosStart);
+            const std::size_t lineStart = (i > 0) ? lineBreaks[i-1] : 0;
+            std::size_t lineEnd = (i < lineBreaks.size()) ? lineBreaks[i] : m_string.getSize();
+            if ((lineEnd > lineStart) && (m_string[lineEnd-1] == '\n'))
+                --lineEnd;
 
             m_lines.emplace_back();
             m_lines.back().setCharacterSize(getTextSize());
@@ -445,15 +487,10 @@ namespace tgui
             m_lines.back().setColor(m_textColorCached);
             m_lines.back().setOpacity(m_opacityCached);
 
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.back().setString(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.back().setString(string.substring(searchPosStart));
+            m_lines.back().setString(m_string.substring(lineStart, lineEnd - lineStart));
 
             if (m_lines.back().getSize().x > width)
                 width = m_lines.back().getSize().x;
-
-            searchPosStart = newLinePos + 1;
         }
 
         const Outline outline = {m_paddingCached.getLeft() + m_bordersCached.getLeft(),
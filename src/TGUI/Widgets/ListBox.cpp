@@ -26,10 +26,52 @@
 #include <TGUI/Widgets/ListBox.hpp>
 #include <TGUI/Clipping.hpp>
 
+#include <algorithm>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Registers in the index map that the item at the given index has the given text or id
+        template <typename IndexMap>
+        void addToIndex(IndexMap& indices, const sf::String& key, std::size_t index)
+        {
+            const auto it = indices.find(key);
+            if (it != indices.end())
+            {
+                it->second.firstIndex = std::min(it->second.firstIndex, index);
+                ++it->second.count;
+            }
+            else
+                indices.emplace(key, typename IndexMap::mapped_type{index, 1});
+        }
+
+        // Removes the item at the given index from the index map. Returns false when the map can't be updated because the
+        // index of the next item with the same text or id would have to be searched or because the item isn't in the map,
+        // the map should be rebuilt in that case.
+        template <typename IndexMap>
+        bool removeFromIndex(IndexMap& indices, const sf::String& key, std::size_t index)
+        {
+            const auto it = indices.find(key);
+            if (it == indices.end())
+                return false;
+            else if (it->second.count == 1)
+            {
+                indices.erase(it);
+                return true;
+            }
+            else if (it->second.firstIndex != index)
+            {
+                --it->second.count;
+                return true;
+            }
+            else
+                return false;
+        }
+    }
+
    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ListBox::ListBox()
@@ -37,6 +79,8 @@ namespace tgui
         m_type = "ListBox";
 
         m_draggableWidget = true;
+        m_batchableWidgetType = &typeid(ListBox);
+        m_mouseOnWidgetInsideBoundsType = &typeid(ListBox);
 
         m_renderer = aurora::makeCopied<ListBoxRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -98,9 +142,6 @@ namespace tgui
     {
         Widget::setPosition(position);
 
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-            m_items[i].setPosition({0, (i * m_itemHeight) + ((m_itemHeight - m_items[i].getSize().y) / 2.0f)});
-
         m_scroll.setPosition(getSize().x - m_bordersCached.getRight() - m_scroll.getSize().x, m_bordersCached.getTop());
     }
 
@@ -125,6 +166,8 @@ namespace tgui
 
     bool ListBox::addItem(const sf::String& itemName, const sf::String& id)
     {
+        invalidate();
+
         // Check if the item limit is reached (if there is one)
         if ((m_maxItems == 0) || (m_items.size() < m_maxItems))
         {
@@ -134,19 +177,16 @@ namespace tgui
             if (m_autoScroll && (m_scroll.getLowValue() < m_scroll.getMaximum()))
                 m_scroll.setValue(m_scroll.getMaximum() - m_scroll.getLowValue());
 
-            // Create the new item
-            Text newItem;
-            newItem.setFont(m_fontCached);
-            newItem.setColor(m_textColorCached);
-            newItem.setOpacity(m_opacityCached);
-            newItem.setStyle(m_textStyleCached);
-            newItem.setCharacterSize(m_textSize);
-            newItem.setString(itemName);
-            newItem.setPosition({0, (m_items.size() * m_itemHeight) + ((m_itemHeight - newItem.getSize().y) / 2.0f)});
-
-            // Add the new item to the list
-            m_items.push_back(std::move(newItem));
+            // Add the new item to the list, its text is only created when it becomes visible
+            m_items.push_back(itemName);
             m_itemIds.push_back(id);
+
+            if (m_itemIndicesValid)
+            {
+                addToIndex(m_itemIndices, itemName, m_items.size() - 1);
+                addToIndex(m_itemIdIndices, id, m_items.size() - 1);
+            }
+
             return true;
         }
         else // The item limit was reached
@@ -155,14 +195,57 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ListBox::setSelectedItem(const sf::String& itemName)
+    std::size_t ListBox::addItems(const std::vector<sf::String>& itemNames, const std::vector<sf::String>& ids)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
+        invalidate();
+
+        // Don't add more items than the item limit allows (if there is one)
+        std::size_t count = itemNames.size();
+        if (m_maxItems > 0)
+            count = std::min(count, (m_maxItems > m_items.size()) ? m_maxItems - m_items.size() : 0);
+
+        if (count == 0)
+            return 0;
+
+        m_items.reserve(m_items.size() + count);
+        m_itemIds.reserve(m_itemIds.size() + count);
+        for (std::size_t i = 0; i < count; ++i)
         {
-            if (m_items[i].getString() == itemName)
-                return setSelectedItemByIndex(i);
+            m_items.push_back(itemNames[i]);
+            m_itemIds.push_back((i < ids.size()) ? ids[i] : "");
+
+            if (m_itemIndicesValid)
+            {
+                addToIndex(m_itemIndices, m_items.back(), m_items.size() - 1);
+                addToIndex(m_itemIdIndices, m_itemIds.back(), m_items.size() - 1);
+            }
         }
 
+        m_scroll.setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
+
+        // Scroll down when auto-scrolling is enabled
+        if (m_autoScroll && (m_scroll.getLowValue() < m_scroll.getMaximum()))
+            m_scroll.setValue(m_scroll.getMaximum() - m_scroll.getLowValue());
+
+        return count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListBox::setItems(const std::vector<sf::String>& itemNames, const std::vector<sf::String>& ids)
+    {
+        removeAllItems();
+        return addItems(itemNames, ids);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::setSelectedItem(const sf::String& itemName)
+    {
+        const int index = findItemIndex(itemName);
+        if (index >= 0)
+            return setSelectedItemByIndex(static_cast<std::size_t>(index));
+
         // No match was found
         deselectItem();
         return false;
@@ -172,11 +255,9 @@ namespace tgui
 
     bool ListBox::setSelectedItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return setSelectedItemByIndex(i);
-        }
+        const int index = findItemIdIndex(id);
+        if (index >= 0)
+            return setSelectedItemByIndex(static_cast<std::size_t>(index));
 
         // No match was found
         deselectItem();
@@ -187,6 +268,8 @@ namespace tgui
 
     bool ListBox::setSelectedItemByIndex(std::size_t index)
     {
+        invalidate();
+
         if (index >= m_items.size())
         {
             deselectItem();
@@ -208,6 +291,8 @@ namespace tgui
 
     void ListBox::deselectItem()
     {
+        invalidate();
+
         updateSelectedItem(-1);
     }
 
@@ -215,32 +300,30 @@ namespace tgui
 
     bool ListBox::removeItem(const sf::String& itemName)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == itemName)
-                return removeItemByIndex(i);
-        }
-
-        return false;
+        const int index = findItemIndex(itemName);
+        if (index >= 0)
+            return removeItemByIndex(static_cast<std::size_t>(index));
+        else
+            return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::removeItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return removeItemByIndex(i);
-        }
-
-        return false;
+        const int index = findItemIdIndex(id);
+        if (index >= 0)
+            return removeItemByIndex(static_cast<std::size_t>(index));
+        else
+            return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::removeItemByIndex(std::size_t index)
     {
+        invalidate();
+
         if (index >= m_items.size())
             return false;
 
@@ -256,12 +339,21 @@ namespace tgui
             m_selectedItem = m_selectedItem - 1;
         }
 
+        // Only the last item can be removed without changing the indices of other items in the maps
+        if (m_itemIndicesValid)
+        {
+            if ((index + 1 < m_items.size())
+             || !removeFromIndex(m_itemIndices, m_items[index], index)
+             || !removeFromIndex(m_itemIdIndices, m_itemIds[index], index))
+                m_itemIndicesValid = false;
+        }
+
         // Remove the item
         m_items.erase(m_items.begin() + index);
         m_itemIds.erase(m_itemIds.begin() + index);
+        m_visibleItemsNeedUpdate = true;
 
         m_scroll.setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-        setPosition(m_position);
 
         return true;
     }
@@ -270,9 +362,14 @@ namespace tgui
 
     void ListBox::removeAllItems()
     {
+        invalidate();
+
         // Clear the list, remove all items
         m_items.clear();
         m_itemIds.clear();
+        m_itemIndices.clear();
+        m_itemIdIndices.clear();
+        m_visibleItemsNeedUpdate = true;
 
         // Unselect any selected item
         updateSelectedItem(-1);
@@ -285,20 +382,15 @@ namespace tgui
 
     sf::String ListBox::getItemById(const sf::String& id) const
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return m_items[i].getString();
-        }
-
-        return "";
+        const int index = findItemIdIndex(id);
+        return (index >= 0) ? m_items[index] : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ListBox::getSelectedItem() const
     {
-        return (m_selectedItem >= 0) ? m_items[m_selectedItem].getString() : "";
+        return (m_selectedItem >= 0) ? m_items[m_selectedItem] : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -319,36 +411,43 @@ namespace tgui
 
     bool ListBox::changeItem(const sf::String& originalValue, const sf::String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == originalValue)
-                return changeItemByIndex(i, newValue);
-        }
-
-        return false;
+        const int index = findItemIndex(originalValue);
+        if (index >= 0)
+            return changeItemByIndex(static_cast<std::size_t>(index), newValue);
+        else
+            return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::changeItemById(const sf::String& id, const sf::String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return changeItemByIndex(i, newValue);
-        }
-
-        return false;
+        const int index = findItemIdIndex(id);
+        if (index >= 0)
+            return changeItemByIndex(static_cast<std::size_t>(index), newValue);
+        else
+            return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::changeItemByIndex(std::size_t index, const sf::String& newValue)
     {
+        invalidate();
+
         if (index >= m_items.size())
             return false;
 
-        m_items[index].setString(newValue);
+        if (m_itemIndicesValid)
+        {
+            if (removeFromIndex(m_itemIndices, m_items[index], index))
+                addToIndex(m_itemIndices, newValue, index);
+            else
+                m_itemIndicesValid = false;
+        }
+
+        m_items[index] = newValue;
+        m_visibleItemsNeedUpdate = true;
         return true;
     }
 
@@ -363,11 +462,7 @@ namespace tgui
 
     std::vector<sf::String> ListBox::getItems() const
     {
-        std::vector<sf::String> items;
-        for (const auto& item : m_items)
-            items.push_back(item.getString());
-
-        return items;
+        return m_items;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -381,18 +476,17 @@ namespace tgui
 
     void ListBox::setItemHeight(unsigned int itemHeight)
     {
+        invalidate();
+
         // Set the new heights
         m_itemHeight = itemHeight;
         if (m_requestedTextSize == 0)
-        {
             m_textSize = Text::findBestTextSize(m_fontCached, itemHeight * 0.8f);
-            for (auto& item : m_items)
-                item.setCharacterSize(m_textSize);
-        }
+
+        m_visibleItemsNeedUpdate = true;
 
         m_scroll.setScrollAmount(m_itemHeight);
         m_scroll.setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-        setPosition(m_position);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -406,6 +500,8 @@ namespace tgui
 
     void ListBox::setTextSize(unsigned int textSize)
     {
+        invalidate();
+
         m_requestedTextSize = textSize;
 
         if (textSize)
@@ -413,10 +509,7 @@ namespace tgui
         else
             m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
-        for (auto& item : m_items)
-            item.setCharacterSize(m_textSize);
-
-        setPosition(m_position);
+        m_visibleItemsNeedUpdate = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -430,6 +523,8 @@ namespace tgui
 
     void ListBox::setMaximumItems(std::size_t maximumItems)
     {
+        invalidate();
+
         // Set the new limit
         m_maxItems = maximumItems;
 
@@ -439,9 +534,10 @@ namespace tgui
             // Remove the items that passed the limitation
             m_items.erase(m_items.begin() + m_maxItems, m_items.end());
             m_itemIds.erase(m_itemIds.begin() + m_maxItems, m_itemIds.end());
+            m_visibleItemsNeedUpdate = true;
+            m_itemIndicesValid = false;
 
             m_scroll.setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-            setPosition(m_position);
         }
     }
 
@@ -470,14 +566,14 @@ namespace tgui
 
     bool ListBox::contains(const sf::String& item) const
     {
-        return std::find_if(m_items.begin(), m_items.end(), [item](const Text& text){ return text.getString() == item; }) != m_items.end();
+        return findItemIndex(item) >= 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::containsId(const sf::String& id) const
     {
-        return std::find(m_itemIds.begin(), m_itemIds.end(), id) != m_itemIds.end();
+        return findItemIdIndex(id) >= 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -513,7 +609,7 @@ namespace tgui
                     updateHoveringItem(-1);
 
                 if (m_hoveringItem >= 0)
-                    onMousePress.emit(this, m_items[m_hoveringItem].getString(), m_itemIds[m_hoveringItem]);
+                    onMousePress.emit(this, m_items[m_hoveringItem], m_itemIds[m_hoveringItem]);
 
                 if (m_selectedItem != m_hoveringItem)
                 {
@@ -532,7 +628,7 @@ namespace tgui
         if (m_mouseDown && !m_scroll.isMouseDown())
         {
             if (m_selectedItem >= 0)
-                onMouseRelease.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                onMouseRelease.emit(this, m_items[m_selectedItem], m_itemIds[m_selectedItem]);
 
             // Check if you double-clicked
             if (m_possibleDoubleClick)
@@ -540,7 +636,7 @@ namespace tgui
                 m_possibleDoubleClick = false;
 
                 if (m_selectedItem >= 0)
-                    onDoubleClick.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                    onDoubleClick.emit(this, m_items[m_selectedItem], m_itemIds[m_selectedItem]);
             }
             else // This is the first click
             {
@@ -635,130 +731,147 @@ namespace tgui
 
     Signal& ListBox::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onItemSelect.getName()))
-            return onItemSelect;
-        else if (signalName == toLower(onMousePress.getName()))
-            return onMousePress;
-        else if (signalName == toLower(onMouseRelease.getName()))
-            return onMouseRelease;
-        else if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
+        static const auto signalMap = createSignalMap<ListBox>(*this, {
+                [](ListBox& widget) -> Signal& { return widget.onItemSelect; },
+                [](ListBox& widget) -> Signal& { return widget.onMousePress; },
+                [](ListBox& widget) -> Signal& { return widget.onMouseRelease; },
+                [](ListBox& widget) -> Signal& { return widget.onDoubleClick; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return Widget::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::rendererChanged(const std::string& property)
+    void ListBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "textcolor")
+        switch (property.getId())
         {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateItemColorsAndStyle();
-        }
-        else if (property == "textcolorhover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateItemColorsAndStyle();
-        }
-        else if (property == "selectedtextcolor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateItemColorsAndStyle();
-        }
-        else if (property == "selectedtextcolorhover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateItemColorsAndStyle();
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "textstyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
 
-            for (auto& item : m_items)
-                item.setStyle(m_textStyleCached);
+            case Property::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+            }
 
-            if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
-        }
-        else if (property == "selectedtextstyle")
-        {
-            m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
+            case Property::TextColor:
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                break;
+            }
 
-            if (m_selectedItem >= 0)
+            case Property::TextColorHover:
             {
-                if (m_selectedTextStyleCached.isSet())
-                    m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
-                else
-                    m_items[m_selectedItem].setStyle(m_textStyleCached);
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                break;
             }
-        }
-        else if (property == "scrollbar")
-        {
-            m_scroll.setRenderer(getSharedRenderer()->getScrollbar());
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "selectedbackgroundcolor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == "selectedbackgroundcolorhover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
 
-            m_scroll.setInheritedOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-            for (auto& item : m_items)
-                item.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+            case Property::SelectedTextColor:
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                break;
+            }
 
-            for (auto& item : m_items)
-                item.setFont(m_fontCached);
+            case Property::SelectedTextColorHover:
+            {
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                break;
+            }
+
+            case Property::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+
+            case Property::TextStyle:
+            {
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
+                m_visibleItemsNeedUpdate = true;
+                break;
+            }
 
-            // Recalculate the text size with the new font
-            if (m_requestedTextSize == 0)
+            case Property::SelectedTextStyle:
             {
-                m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
-                for (auto& item : m_items)
-                    item.setCharacterSize(m_textSize);
+                m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
+                break;
             }
 
-            setPosition(m_position);
+            case Property::Scrollbar:
+            {
+                m_scroll.setRenderer(getSharedRenderer()->getScrollbar());
+                break;
+            }
+
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case Property::BackgroundColorHover:
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+
+            case Property::SelectedBackgroundColor:
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+            }
+
+            case Property::SelectedBackgroundColorHover:
+            {
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+            }
+
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                m_scroll.setInheritedOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_visibleItemsNeedUpdate = true;
+                break;
+            }
+
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
+
+                // Recalculate the text size with the new font
+                if (m_requestedTextSize == 0)
+                    m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+
+                m_visibleItemsNeedUpdate = true;
+                break;
+            }
+
+            default:
+            {
+                Widget::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -820,16 +933,26 @@ namespace tgui
                 if (node->propertyValuePairs["items"]->valueList.size() != node->propertyValuePairs["itemids"]->valueList.size())
                     throw Exception{"Amounts of values for 'Items' differs from the amount in 'ItemIds'"};
 
+                std::vector<sf::String> items;
+                std::vector<sf::String> ids;
+                items.reserve(node->propertyValuePairs["items"]->valueList.size());
+                ids.reserve(node->propertyValuePairs["itemids"]->valueList.size());
                 for (std::size_t i = 0; i < node->propertyValuePairs["items"]->valueList.size(); ++i)
                 {
-                    addItem(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["items"]->valueList[i]).getString(),
-                            Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["itemids"]->valueList[i]).getString());
+                    items.push_back(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["items"]->valueList[i]).getString());
+                    ids.push_back(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["itemids"]->valueList[i]).getString());
                 }
+
+                addItems(items, ids);
             }
             else // There are no item ids
             {
+                std::vector<sf::String> items;
+                items.reserve(node->propertyValuePairs["items"]->valueList.size());
                 for (const auto& item : node->propertyValuePairs["items"]->valueList)
-                    addItem(Deserializer::deserialize(ObjectConverter::Type::String, item).getString());
+                    items.push_back(Deserializer::deserialize(ObjectConverter::Type::String, item).getString());
+
+                addItems(items);
             }
         }
         else // If there are no items, there should be no item ids
@@ -863,57 +986,140 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateSelectedAndHoveringItemColorsAndStyle()
+    int ListBox::findItemIndex(const sf::String& itemName) const
     {
-        if (m_selectedItem >= 0)
-        {
-            if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
-                m_items[m_selectedItem].setColor(m_selectedTextColorHoverCached);
-            else if (m_selectedTextColorCached.isSet())
-                m_items[m_selectedItem].setColor(m_selectedTextColorCached);
+        updateItemIndices();
 
-            if (m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
-        }
+        const auto it = m_itemIndices.find(itemName);
+        if (it != m_itemIndices.end())
+            return static_cast<int>(it->second.firstIndex);
+        else
+            return -1;
+    }
 
-        if ((m_hoveringItem >= 0) && (m_selectedItem != m_hoveringItem))
-        {
-            if (m_textColorHoverCached.isSet())
-                m_items[m_hoveringItem].setColor(m_textColorHoverCached);
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListBox::findItemIdIndex(const sf::String& id) const
+    {
+        updateItemIndices();
+
+        const auto it = m_itemIdIndices.find(id);
+        if (it != m_itemIdIndices.end())
+            return static_cast<int>(it->second.firstIndex);
+        else
+            return -1;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateItemColorsAndStyle()
+    void ListBox::updateItemIndices() const
     {
-        for (auto& item : m_items)
+        if (m_itemIndicesValid)
+            return;
+
+        m_itemIndices.clear();
+        m_itemIdIndices.clear();
+        for (std::size_t i = 0; i < m_items.size(); ++i)
         {
-            item.setColor(m_textColorCached);
-            item.setStyle(m_textStyleCached);
+            addToIndex(m_itemIndices, m_items[i], i);
+            addToIndex(m_itemIdIndices, m_itemIds[i], i);
         }
 
-        updateSelectedAndHoveringItemColorsAndStyle();
+        m_itemIndicesValid = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateHoveringItem(int item)
+    void ListBox::updateVisibleItems(std::size_t firstItem, std::size_t lastItem) const
     {
-        if (m_hoveringItem != item)
+        const std::size_t oldCount = m_visibleItems.size();
+        const std::size_t newCount = lastItem - firstItem;
+
+        const auto initText = [this](Text& text){
+                text.setFont(m_fontCached);
+                text.setCharacterSize(m_textSize);
+                text.setOpacity(m_opacityCached);
+            };
+
+        // Find out which items already had a text with the correct string
+        std::size_t reusedStart = 0;
+        std::size_t reusedEnd = 0;
+        if (m_visibleItemsNeedUpdate)
+        {
+            for (auto& text : m_visibleItems)
+                initText(text);
+        }
+        else
+        {
+            reusedStart = std::max(firstItem, m_visibleItemsStart);
+            reusedEnd = std::min(lastItem, m_visibleItemsStart + oldCount);
+        }
+
+        if (newCount > oldCount)
+        {
+            m_visibleItems.resize(newCount);
+            for (std::size_t i = oldCount; i < newCount; ++i)
+                initText(m_visibleItems[i]);
+        }
+
+        // Move the texts that can be reused to the place of their item, the other texts will be given a new string
+        if (reusedStart < reusedEnd)
+        {
+            if (firstItem > m_visibleItemsStart)
+                std::rotate(m_visibleItems.begin(), m_visibleItems.begin() + (firstItem - m_visibleItemsStart), m_visibleItems.end());
+            else if (firstItem < m_visibleItemsStart)
+                std::rotate(m_visibleItems.begin(), m_visibleItems.end() - (m_visibleItemsStart - firstItem), m_visibleItems.end());
+        }
+
+        m_visibleItems.erase(m_visibleItems.begin() + newCount, m_visibleItems.end());
+
+        for (std::size_t i = 0; i < newCount; ++i)
         {
-            if (m_hoveringItem >= 0)
+            const std::size_t item = firstItem + i;
+            updateItemColorAndStyle(m_visibleItems[i], item);
+
+            if ((item < reusedStart) || (item >= reusedEnd))
             {
-                if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorCached.isSet())
-                    m_items[m_hoveringItem].setColor(m_selectedTextColorCached);
-                else
-                    m_items[m_hoveringItem].setColor(m_textColorCached);
+                m_visibleItems[i].setString(m_items[item]);
+                m_visibleItems[i].setPosition({0, (item * m_itemHeight) + ((m_itemHeight - m_visibleItems[i].getSize().y) / 2.0f)});
             }
+        }
+
+        m_visibleItemsStart = firstItem;
+        m_visibleItemsNeedUpdate = false;
+    }
 
-            m_hoveringItem = item;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            updateSelectedAndHoveringItemColorsAndStyle();
+    void ListBox::updateItemColorAndStyle(Text& text, std::size_t item) const
+    {
+        Color color = m_textColorCached;
+        TextStyle style = m_textStyleCached;
+        if (static_cast<int>(item) == m_selectedItem)
+        {
+            if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
+                color = m_selectedTextColorHoverCached;
+            else if (m_selectedTextColorCached.isSet())
+                color = m_selectedTextColorCached;
+
+            if (m_selectedTextStyleCached.isSet())
+                style = m_selectedTextStyleCached;
         }
+        else if ((static_cast<int>(item) == m_hoveringItem) && m_textColorHoverCached.isSet())
+            color = m_textColorHoverCached;
+
+        // Changing the color causes the vertices of the text to be recreated, so only do it when the color really changes
+        if (text.getColor() != color)
+            text.setColor(color);
+
+        text.setStyle(style);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateHoveringItem(int item)
+    {
+        m_hoveringItem = item;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -922,23 +1128,11 @@ namespace tgui
     {
         if (m_selectedItem != item)
         {
-            if (m_selectedItem >= 0)
-            {
-                if ((m_selectedItem == m_hoveringItem) && m_textColorHoverCached.isSet())
-                    m_items[m_selectedItem].setColor(m_textColorHoverCached);
-                else
-                    m_items[m_selectedItem].setColor(m_textColorCached);
-
-                m_items[m_selectedItem].setStyle(m_textStyleCached);
-            }
-
             m_selectedItem = item;
             if (m_selectedItem >= 0)
-                onItemSelect.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                onItemSelect.emit(this, m_items[m_selectedItem], m_itemIds[m_selectedItem]);
             else
                 onItemSelect.emit(this, "", "");
-
-            updateSelectedAndHoveringItemColorsAndStyle();
         }
     }
 
@@ -996,6 +1190,8 @@ namespace tgui
                     ++lastItem;
             }
 
+            updateVisibleItems(firstItem, lastItem);
+
             states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop() - m_scroll.getValue()});
 
             // Draw the background of the selected item
@@ -1022,8 +1218,8 @@ namespace tgui
 
             // Draw the items
             states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached), 0});
-            for (std::size_t i = firstItem; i < lastItem; ++i)
-                m_items[i].draw(target, states);
+            for (const auto& text : m_visibleItems)
+                text.draw(target, states);
         }
 
         // Draw the scrollbar
@@ -26,6 +26,7 @@
 #include <TGUI/Widgets/MenuBar.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Clipping.hpp>
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -36,6 +37,7 @@ namespace tgui
     MenuBar::MenuBar()
     {
         m_type = "MenuBar";
+        m_batchableWidgetType = &typeid(MenuBar);
         m_distanceToSideCached = Text::getLineHeight(m_fontCached, getGlobalTextSize()) * 0.4f;
 
         m_renderer = aurora::makeCopied<MenuBarRenderer>();
@@ -104,6 +106,8 @@ namespace tgui
 
     void MenuBar::addMenu(const sf::String& text)
     {
+        invalidate();
+
         Menu newMenu;
         newMenu.text.setFont(m_fontCached);
         newMenu.text.setColor(m_textColorCached);
@@ -117,20 +121,15 @@ namespace tgui
 
     bool MenuBar::addMenuItem(const sf::String& menu, const sf::String& text)
     {
+        invalidate();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_menus.size(); ++i)
         {
             // If this is the menu then add the menu item to it
             if (m_menus[i].text.getString() == menu)
             {
-                Text menuItem;
-                menuItem.setFont(m_fontCached);
-                menuItem.setColor(m_textColorCached);
-                menuItem.setOpacity(m_opacityCached);
-                menuItem.setCharacterSize(m_textSize);
-                menuItem.setString(text);
-
-                m_menus[i].menuItems.push_back(std::move(menuItem));
+                m_menus[i].menuItems.push_back(createMenuItem(text));
                 return true;
             }
         }
@@ -151,8 +150,34 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool MenuBar::addMenuItems(const sf::String& menu, const std::vector<sf::String>& texts)
+    {
+        invalidate();
+
+        // Search for the menu
+        for (unsigned int i = 0; i < m_menus.size(); ++i)
+        {
+            // If this is the menu then add the menu items to it
+            if (m_menus[i].text.getString() == menu)
+            {
+                m_menus[i].menuItems.reserve(m_menus[i].menuItems.size() + texts.size());
+                for (const auto& text : texts)
+                    m_menus[i].menuItems.push_back(createMenuItem(text));
+
+                return true;
+            }
+        }
+
+        // Could not find the menu
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool MenuBar::removeMenu(const sf::String& menu)
     {
+        invalidate();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_menus.size(); ++i)
         {
@@ -177,6 +202,8 @@ namespace tgui
 
     bool MenuBar::removeMenuItem(const sf::String& menu, const sf::String& menuItem)
     {
+        invalidate();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_menus.size(); ++i)
         {
@@ -208,6 +235,8 @@ namespace tgui
 
     void MenuBar::removeAllMenus()
     {
+        invalidate();
+
         m_menus.clear();
     }
 
@@ -215,6 +244,8 @@ namespace tgui
 
     void MenuBar::setTextSize(unsigned int size)
     {
+        invalidate();
+
         m_textSize = size;
 
         for (unsigned int i = 0; i < m_menus.size(); ++i)
@@ -237,6 +268,8 @@ namespace tgui
 
     void MenuBar::setMinimumSubMenuWidth(float minimumWidth)
     {
+        invalidate();
+
         m_minimumSubMenuWidth = minimumWidth;
     }
 
@@ -251,6 +284,8 @@ namespace tgui
 
     void MenuBar::setInvertedMenuDirection(bool invertDirection)
     {
+        invalidate();
+
         m_invertedMenuDirection = invertDirection;
     }
 
@@ -286,6 +321,8 @@ namespace tgui
         // Check if there is still a menu open
         if (m_visibleMenu != -1)
         {
+            invalidateOpenMenu();
+
             // If an item in that menu was selected then unselect it first
             if (m_menus[m_visibleMenu].selectedMenuItem != -1)
             {
@@ -344,6 +381,8 @@ namespace tgui
 
     void MenuBar::leftMousePressed(Vector2f pos)
     {
+        invalidateOpenMenu();
+
         // Check if a menu should be opened or closed
         if (FloatRect{0, 0, getSize().x, getSize().y}.contains(pos))
         {
@@ -384,6 +423,7 @@ namespace tgui
         }
 
         m_mouseDown = true;
+        invalidateOpenMenu();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -424,6 +464,8 @@ namespace tgui
         if (!m_mouseHover)
             mouseEnteredWidget();
 
+        invalidateOpenMenu();
+
         // Check if the mouse is on top of the menu bar (not on an open menus)
         if (FloatRect{0, 0, getSize().x, getSize().y}.contains(pos))
         {
@@ -492,6 +534,8 @@ namespace tgui
                     m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
             }
         }
+
+        invalidateOpenMenu();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -511,6 +555,8 @@ namespace tgui
         // Menu items which are selected on mouse hover should not remain selected now that the mouse has left
         if ((m_visibleMenu != -1) && (m_menus[m_visibleMenu].selectedMenuItem != -1))
         {
+            invalidateOpenMenu();
+
             m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
             m_menus[m_visibleMenu].selectedMenuItem = -1;
         }
@@ -520,105 +566,171 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void MenuBar::invalidateOpenMenu()
+    {
+        if (!m_parent || !m_visible || (m_visibleMenu == -1))
+            return;
+
+        float left = 0;
+        for (int i = 0; i < m_visibleMenu; ++i)
+            left += m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
+
+        float width = m_minimumSubMenuWidth;
+        for (const auto& menuItem : m_menus[m_visibleMenu].menuItems)
+            width = std::max(width, menuItem.getSize().x + (3 * m_distanceToSideCached));
+
+        const float height = getSize().y * m_menus[m_visibleMenu].menuItems.size();
+        if (m_invertedMenuDirection)
+            m_parent->invalidateChildRegion({getPosition().x + left, getPosition().y - height, width, height});
+        else
+            m_parent->invalidateChildRegion({getPosition().x + left, getPosition().y + getSize().y, width, height});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Text MenuBar::createMenuItem(const sf::String& text) const
+    {
+        Text menuItem;
+        menuItem.setFont(m_fontCached);
+        menuItem.setColor(m_textColorCached);
+        menuItem.setOpacity(m_opacityCached);
+        menuItem.setCharacterSize(m_textSize);
+        menuItem.setString(text);
+        return menuItem;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Signal& MenuBar::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onMenuItemClick.getName()))
-            return onMenuItemClick;
+        static const auto signalMap = createSignalMap<MenuBar>(*this, {
+                [](MenuBar& widget) -> Signal& { return widget.onMenuItemClick; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return Widget::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MenuBar::rendererChanged(const std::string& property)
+    void MenuBar::rendererChanged(PropertyId property)
     {
-        if (property == "textcolor")
+        switch (property.getId())
         {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-
-            for (unsigned int i = 0; i < m_menus.size(); ++i)
+            case Property::TextColor:
             {
-                for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
+                m_textColorCached = getSharedRenderer()->getTextColor();
+
+                for (unsigned int i = 0; i < m_menus.size(); ++i)
                 {
-                    if (m_menus[i].selectedMenuItem != static_cast<int>(j))
-                        m_menus[i].menuItems[j].setColor(m_textColorCached);
+                    for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
+                    {
+                        if (m_menus[i].selectedMenuItem != static_cast<int>(j))
+                            m_menus[i].menuItems[j].setColor(m_textColorCached);
+                    }
+
+                    m_menus[i].text.setColor(m_textColorCached);
                 }
 
-                m_menus[i].text.setColor(m_textColorCached);
+                if ((m_visibleMenu != -1) && (m_menus[m_visibleMenu].selectedMenuItem != -1) && m_selectedTextColorCached.isSet())
+                    m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_selectedTextColorCached);
+                break;
             }
 
-            if ((m_visibleMenu != -1) && (m_menus[m_visibleMenu].selectedMenuItem != -1) && m_selectedTextColorCached.isSet())
-                m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_selectedTextColorCached);
-        }
-        else if (property == "selectedtextcolor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-
-            if (m_visibleMenu != -1)
+            case Property::SelectedTextColor:
             {
-                if (m_menus[m_visibleMenu].selectedMenuItem != -1)
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+
+                if (m_visibleMenu != -1)
                 {
-                    if (m_selectedTextColorCached.isSet())
-                        m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_selectedTextColorCached);
-                    else
-                        m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
+                    if (m_menus[m_visibleMenu].selectedMenuItem != -1)
+                    {
+                        if (m_selectedTextColorCached.isSet())
+                            m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_selectedTextColorCached);
+                        else
+                            m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
+                    }
                 }
+                break;
             }
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "textureitembackground")
-        {
-            m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
-        }
-        else if (property == "textureselecteditembackground")
-        {
-            m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "selectedbackgroundcolor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == "distancetoside")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
 
-            for (unsigned int i = 0; i < m_menus.size(); ++i)
+            case Property::TextureBackground:
             {
-                for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
-                    m_menus[i].menuItems[j].setOpacity(m_opacityCached);
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
 
-                m_menus[i].text.setOpacity(m_opacityCached);
+            case Property::TextureItemBackground:
+            {
+                m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
+                break;
             }
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+            case Property::TextureSelectedItemBackground:
+            {
+                m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
+                break;
+            }
 
-            for (unsigned int i = 0; i < m_menus.size(); ++i)
+            case Property::BackgroundColor:
             {
-                for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
-                    m_menus[i].menuItems[j].setFont(m_fontCached);
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case Property::SelectedBackgroundColor:
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+            }
+
+            case Property::DistanceToSide:
+            {
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+                break;
+            }
+
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                for (unsigned int i = 0; i < m_menus.size(); ++i)
+                {
+                    for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
+                        m_menus[i].menuItems[j].setOpacity(m_opacityCached);
+
+                    m_menus[i].text.setOpacity(m_opacityCached);
+                }
 
-                m_menus[i].text.setFont(m_fontCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                break;
             }
 
-            setTextSize(Text::findBestTextSize(m_fontCached, getSize().y * 0.8f));
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
+
+                for (unsigned int i = 0; i < m_menus.size(); ++i)
+                {
+                    for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
+                        m_menus[i].menuItems[j].setFont(m_fontCached);
+
+                    m_menus[i].text.setFont(m_fontCached);
+                }
+
+                setTextSize(Text::findBestTextSize(m_fontCached, getSize().y * 0.8f));
+                break;
+            }
+
+            default:
+            {
+                Widget::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -679,8 +791,12 @@ namespace tgui
                         if (!childNode->propertyValuePairs["items"]->listNode)
                             throw Exception{"Failed to parse 'Items' property inside 'Menu' property, expected a list as value"};
 
+                        std::vector<sf::String> menuItems;
+                        menuItems.reserve(childNode->propertyValuePairs["items"]->valueList.size());
                         for (std::size_t i = 0; i < childNode->propertyValuePairs["items"]->valueList.size(); ++i)
-                            addMenuItem(Deserializer::deserialize(ObjectConverter::Type::String, childNode->propertyValuePairs["items"]->valueList[i]).getString());
+                            menuItems.push_back(Deserializer::deserialize(ObjectConverter::Type::String, childNode->propertyValuePairs["items"]->valueList[i]).getString());
+
+                        addMenuItems(m_menus.back().text.getString(), menuItems);
                     }
                 }
             }
@@ -35,6 +35,7 @@ namespace tgui
     MessageBox::MessageBox()
     {
         m_type = "MessageBox";
+        m_batchableWidgetType = &typeid(MessageBox);
 
         m_renderer = aurora::makeCopied<MessageBoxRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -295,39 +296,56 @@ namespace tgui
 
     Signal& MessageBox::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onButtonPress.getName()))
-            return onButtonPress;
+        static const auto signalMap = createSignalMap<MessageBox>(*this, {
+                [](MessageBox& widget) -> Signal& { return widget.onButtonPress; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return ChildWindow::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MessageBox::rendererChanged(const std::string& property)
+    void MessageBox::rendererChanged(PropertyId property)
     {
-        if (property == "textcolor")
-        {
-            m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "button")
-        {
-            const auto& renderer = getSharedRenderer()->getButton();
-            for (auto& button : m_buttons)
-                button->setRenderer(renderer);
-        }
-        else if (property == "font")
+        switch (property.getId())
         {
-            ChildWindow::rendererChanged(property);
+            case Property::TextColor:
+            {
+                m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
+                break;
+            }
 
-            m_label->setInheritedFont(m_fontCached);
+            case Property::Button:
+            {
+                const auto& renderer = getSharedRenderer()->getButton();
+                for (auto& button : m_buttons)
+                    button->setRenderer(renderer);
+                break;
+            }
 
-            for (auto& button : m_buttons)
-                button->setInheritedFont(m_fontCached);
+            case Property::Font:
+            {
+                ChildWindow::rendererChanged(property);
+
+                m_label->setInheritedFont(m_fontCached);
 
-            rearrange();
+                for (auto& button : m_buttons)
+                    button->setInheritedFont(m_fontCached);
+
+                rearrange();
+                break;
+            }
+
+            default:
+            {
+                ChildWindow::rendererChanged(property);
+                break;
+            }
         }
-        else
-            ChildWindow::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
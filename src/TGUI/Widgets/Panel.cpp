@@ -35,6 +35,8 @@ namespace tgui
     Panel::Panel(const Layout2d& size)
     {
         m_type = "Panel";
+        m_batchableWidgetType = &typeid(Panel);
+        m_mouseOnWidgetInsideBoundsType = &typeid(Panel);
 
         m_renderer = aurora::makeCopied<PanelRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -148,35 +150,50 @@ namespace tgui
 
     Signal& Panel::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onMousePress.getName()))
-            return onMousePress;
-        else if (signalName == toLower(onMouseRelease.getName()))
-            return onMouseRelease;
-        else if (signalName == toLower(onClick.getName()))
-            return onClick;
+        static const auto signalMap = createSignalMap<Panel>(*this, {
+                [](Panel& widget) -> Signal& { return widget.onMousePress; },
+                [](Panel& widget) -> Signal& { return widget.onMouseRelease; },
+                [](Panel& widget) -> Signal& { return widget.onClick; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return Group::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Panel::rendererChanged(const std::string& property)
+    void Panel::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "bordercolor")
+        switch (property.getId())
         {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
+
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            default:
+            {
+                Group::rendererChanged(property);
+                break;
+            }
         }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else
-            Group::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
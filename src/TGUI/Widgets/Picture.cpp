@@ -34,6 +34,8 @@ namespace tgui
     Picture::Picture()
     {
         m_type = "Picture";
+        m_batchableWidgetType = &typeid(Picture);
+        m_mouseOnWidgetInsideBoundsType = &typeid(Picture);
 
         m_renderer = aurora::makeCopied<PictureRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -164,36 +166,54 @@ namespace tgui
 
     Signal& Picture::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
+        static const auto signalMap = createSignalMap<Picture>(*this, {
+                [](Picture& widget) -> Signal& { return widget.onDoubleClick; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return ClickableWidget::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Picture::rendererChanged(const std::string& property)
+    void Picture::rendererChanged(PropertyId property)
     {
-        if (property == "texture")
+        switch (property.getId())
         {
-            const auto& texture = getSharedRenderer()->getTexture();
+            case Property::Texture:
+            {
+                const auto& texture = getSharedRenderer()->getTexture();
 
-            if (!m_sprite.isSet() && (getSize() == Vector2f{0,0}))
-                setSize(texture.getImageSize());
+                // When the image was loaded asynchronously, its size only became known when the texture finished loading
+                if ((getSize() == Vector2f{0,0}) && (!m_sprite.isSet() || (m_sprite.getTexture().getData() == texture.getData())))
+                    setSize(texture.getImageSize());
 
-            m_sprite.setTexture(texture);
-        }
-        else if (property == "ignoretransparentparts")
-        {
-            m_ignoreTransparentParts = getSharedRenderer()->getIgnoreTransparentParts();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
-            m_sprite.setOpacity(m_opacityCached);
+                m_sprite.setTexture(texture);
+                break;
+            }
+
+            case Property::IgnoreTransparentParts:
+            {
+                m_ignoreTransparentParts = getSharedRenderer()->getIgnoreTransparentParts();
+                break;
+            }
+
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+                m_sprite.setOpacity(m_opacityCached);
+                break;
+            }
+
+            default:
+            {
+                Widget::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
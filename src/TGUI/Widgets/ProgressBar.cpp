@@ -35,6 +35,8 @@ namespace tgui
     ProgressBar::ProgressBar()
     {
         m_type = "ProgressBar";
+        m_batchableWidgetType = &typeid(ProgressBar);
+        m_mouseOnWidgetInsideBoundsType = &typeid(ProgressBar);
         m_textBack.setFont(m_fontCached);
         m_textFront.setFont(m_fontCached);
 
@@ -113,6 +115,8 @@ namespace tgui
 
     void ProgressBar::setMinimum(unsigned int minimum)
     {
+        invalidate();
+
         // Set the new minimum
         m_minimum = minimum;
 
@@ -139,6 +143,8 @@ namespace tgui
 
     void ProgressBar::setMaximum(unsigned int maximum)
     {
+        invalidate();
+
         // Set the new maximum
         m_maximum = maximum;
 
@@ -165,6 +171,8 @@ namespace tgui
 
     void ProgressBar::setValue(unsigned int value)
     {
+        invalidate();
+
         // When the value is below the minimum or above the maximum then adjust it
         if (value < m_minimum)
             value = m_minimum;
@@ -208,6 +216,8 @@ namespace tgui
 
     void ProgressBar::setText(const sf::String& text)
     {
+        invalidate();
+
         // Set the new text
         m_textBack.setString(text);
         m_textFront.setString(text);
@@ -263,6 +273,8 @@ namespace tgui
 
     void ProgressBar::setFillDirection(FillDirection direction)
     {
+        invalidate();
+
         m_fillDirection = direction;
         recalculateFillSize();
     }
@@ -278,78 +290,109 @@ namespace tgui
 
     Signal& ProgressBar::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onValueChange.getName()))
-            return onValueChange;
-        else if (signalName == toLower(onFull.getName()))
-            return onFull;
+        static const auto signalMap = createSignalMap<ProgressBar>(*this, {
+                [](ProgressBar& widget) -> Signal& { return widget.onValueChange; },
+                [](ProgressBar& widget) -> Signal& { return widget.onFull; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return ClickableWidget::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ProgressBar::rendererChanged(const std::string& property)
+    void ProgressBar::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        switch (property.getId())
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if ((property == "textcolor") || (property == "textcolorfilled"))
-        {
-            m_textBack.setColor(getSharedRenderer()->getTextColor());
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
 
-            if (getSharedRenderer()->getTextColorFilled().isSet())
-                m_textFront.setColor(getSharedRenderer()->getTextColorFilled());
-            else
-                m_textFront.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "texturefill")
-        {
-            m_spriteFill.setTexture(getSharedRenderer()->getTextureFill());
-            recalculateFillSize();
-        }
-        else if (property == "textstyle")
-        {
-            m_textBack.setStyle(getSharedRenderer()->getTextStyle());
-            m_textFront.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "fillcolor")
-        {
-            m_fillColorCached = getSharedRenderer()->getFillColor();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+            case Property::TextColor:
+            case Property::TextColorFilled:
+            {
+                m_textBack.setColor(getSharedRenderer()->getTextColor());
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteFill.setOpacity(m_opacityCached);
+                if (getSharedRenderer()->getTextColorFilled().isSet())
+                    m_textFront.setColor(getSharedRenderer()->getTextColorFilled());
+                else
+                    m_textFront.setColor(getSharedRenderer()->getTextColor());
+                break;
+            }
 
-            m_textBack.setOpacity(m_opacityCached);
-            m_textFront.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+            case Property::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+
+            case Property::TextureFill:
+            {
+                m_spriteFill.setTexture(getSharedRenderer()->getTextureFill());
+                recalculateFillSize();
+                break;
+            }
+
+            case Property::TextStyle:
+            {
+                m_textBack.setStyle(getSharedRenderer()->getTextStyle());
+                m_textFront.setStyle(getSharedRenderer()->getTextStyle());
+                break;
+            }
+
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
 
-            m_textBack.setFont(m_fontCached);
-            m_textFront.setFont(m_fontCached);
-            setText(getText());
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case Property::FillColor:
+            {
+                m_fillColorCached = getSharedRenderer()->getFillColor();
+                break;
+            }
+
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteFill.setOpacity(m_opacityCached);
+
+                m_textBack.setOpacity(m_opacityCached);
+                m_textFront.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
+
+                m_textBack.setFont(m_fontCached);
+                m_textFront.setFont(m_fontCached);
+                setText(getText());
+                break;
+            }
+
+            default:
+            {
+                Widget::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -467,7 +510,7 @@ namespace tgui
 
     Vector2f ProgressBar::getFrontImageSize() const
     {
-        if (m_spriteBackground.isSet())
+        if (m_spriteBackground.isSet() && (m_spriteBackground.getTexture().getImageSize().x > 0) && (m_spriteBackground.getTexture().getImageSize().y > 0))
         {
             switch (m_spriteBackground.getScalingType())
             {
@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/VertexBatch.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 
 namespace tgui
@@ -34,6 +35,7 @@ namespace tgui
     RadioButton::RadioButton()
     {
         m_type = "RadioButton";
+        m_batchableWidgetType = &typeid(RadioButton);
         m_text.setFont(m_fontCached);
 
         m_renderer = aurora::makeCopied<RadioButtonRenderer>();
@@ -128,6 +130,8 @@ namespace tgui
 
     void RadioButton::check()
     {
+        invalidate();
+
         if (!m_checked)
         {
             // Tell our parent that all the radio buttons should be unchecked
@@ -151,6 +155,8 @@ namespace tgui
 
     void RadioButton::uncheck()
     {
+        invalidate();
+
         if (m_checked)
         {
             m_checked = false;
@@ -166,6 +172,8 @@ namespace tgui
 
     void RadioButton::setText(const sf::String& text)
     {
+        invalidate();
+
         // Set the new text
         m_text.setString(text);
 
@@ -291,165 +299,237 @@ namespace tgui
 
     Signal& RadioButton::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onCheck.getName()))
-            return onCheck;
-        else if (signalName == toLower(onUncheck.getName()))
-            return onUncheck;
+        static const auto signalMap = createSignalMap<RadioButton>(*this, {
+                [](RadioButton& widget) -> Signal& { return widget.onCheck; },
+                [](RadioButton& widget) -> Signal& { return widget.onUncheck; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return ClickableWidget::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RadioButton::rendererChanged(const std::string& property)
+    void RadioButton::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            m_bordersCached.updateParentSize(getSize());
-            updateTextureSizes();
-        }
-        else if ((property == "textcolor") || (property == "textcolorhover") || (property == "textcolordisabled")
-              || (property == "textcolorchecked") || (property == "textcolorcheckedhover") || (property == "textcolorcheckeddisabled"))
+        switch (property.getId())
         {
-            updateTextColor();
-        }
-        else if (property == "textstyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                m_bordersCached.updateParentSize(getSize());
+                updateTextureSizes();
+                break;
+            }
 
-            if (m_checked && m_textStyleCheckedCached.isSet())
-                m_text.setStyle(m_textStyleCheckedCached);
-            else
-                m_text.setStyle(m_textStyleCached);
-        }
-        else if (property == "textstylechecked")
-        {
-            m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
+            case Property::TextColor:
+            case Property::TextColorHover:
+            case Property::TextColorDisabled:
+            case Property::TextColorChecked:
+            case Property::TextColorCheckedHover:
+            case Property::TextColorCheckedDisabled:
+            {
+                updateTextColor();
+                break;
+            }
 
-            if (m_checked && m_textStyleCheckedCached.isSet())
-                m_text.setStyle(m_textStyleCheckedCached);
-            else
-                m_text.setStyle(m_textStyleCached);
-        }
-        else if (property == "textureunchecked")
-        {
-            m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
-            updateTextureSizes();
-        }
-        else if (property == "texturechecked")
-        {
-            m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
-            updateTextureSizes();
-        }
-        else if (property == "textureuncheckedhover")
-        {
-            m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
-        }
-        else if (property == "texturecheckedhover")
-        {
-            m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
-        }
-        else if (property == "textureuncheckeddisabled")
-        {
-            m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
-        }
-        else if (property == "texturecheckeddisabled")
-        {
-            m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
-        }
-        else if (property == "texturefocused")
-        {
-            m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
-            m_allowFocus = m_spriteFocused.isSet();
-        }
-        else if (property == "checkcolor")
-        {
-            m_checkColorCached = getSharedRenderer()->getCheckColor();
-        }
-        else if (property == "checkcolorhover")
-        {
-            m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
-        }
-        else if (property == "checkcolordisabled")
-        {
-            m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "bordercolorhover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == "bordercolordisabled")
-        {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
-        }
-        else if (property == "bordercolorchecked")
-        {
-            m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
-        }
-        else if (property == "bordercolorcheckedhover")
-        {
-            m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
-        }
-        else if (property == "bordercolorcheckeddisabled")
-        {
-            m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "backgroundcolordisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == "backgroundcolorchecked")
-        {
-            m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
-        }
-        else if (property == "backgroundcolorcheckedhover")
-        {
-            m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
-        }
-        else if (property == "backgroundcolorcheckeddisabled")
-        {
-            m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
-        }
-        else if (property == "textdistanceratio")
-        {
-            m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+            case Property::TextStyle:
+            {
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
 
-            m_spriteUnchecked.setOpacity(m_opacityCached);
-            m_spriteChecked.setOpacity(m_opacityCached);
-            m_spriteUncheckedHover.setOpacity(m_opacityCached);
-            m_spriteCheckedHover.setOpacity(m_opacityCached);
-            m_spriteUncheckedDisabled.setOpacity(m_opacityCached);
-            m_spriteCheckedDisabled.setOpacity(m_opacityCached);
-            m_spriteFocused.setOpacity(m_opacityCached);
+                if (m_checked && m_textStyleCheckedCached.isSet())
+                    m_text.setStyle(m_textStyleCheckedCached);
+                else
+                    m_text.setStyle(m_textStyleCached);
+                break;
+            }
 
-            m_text.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+            case Property::TextStyleChecked:
+            {
+                m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
 
-            m_text.setFont(m_fontCached);
-            setText(getText());
+                if (m_checked && m_textStyleCheckedCached.isSet())
+                    m_text.setStyle(m_textStyleCheckedCached);
+                else
+                    m_text.setStyle(m_textStyleCached);
+                break;
+            }
+
+            case Property::TextureUnchecked:
+            {
+                m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
+                updateTextureSizes();
+                break;
+            }
+
+            case Property::TextureChecked:
+            {
+                m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
+                updateTextureSizes();
+                break;
+            }
+
+            case Property::TextureUncheckedHover:
+            {
+                m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
+                break;
+            }
+
+            case Property::TextureCheckedHover:
+            {
+                m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
+                break;
+            }
+
+            case Property::TextureUncheckedDisabled:
+            {
+                m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
+                break;
+            }
+
+            case Property::TextureCheckedDisabled:
+            {
+                m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
+                break;
+            }
+
+            case Property::TextureFocused:
+            {
+                m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
+                m_allowFocus = m_spriteFocused.isSet();
+                break;
+            }
+
+            case Property::CheckColor:
+            {
+                m_checkColorCached = getSharedRenderer()->getCheckColor();
+                break;
+            }
+
+            case Property::CheckColorHover:
+            {
+                m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
+                break;
+            }
+
+            case Property::CheckColorDisabled:
+            {
+                m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
+                break;
+            }
+
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case Property::BorderColorHover:
+            {
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+            }
+
+            case Property::BorderColorDisabled:
+            {
+                m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+                break;
+            }
+
+            case Property::BorderColorChecked:
+            {
+                m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
+                break;
+            }
+
+            case Property::BorderColorCheckedHover:
+            {
+                m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
+                break;
+            }
+
+            case Property::BorderColorCheckedDisabled:
+            {
+                m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
+                break;
+            }
+
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case Property::BackgroundColorHover:
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+
+            case Property::BackgroundColorDisabled:
+            {
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+            }
+
+            case Property::BackgroundColorChecked:
+            {
+                m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
+                break;
+            }
+
+            case Property::BackgroundColorCheckedHover:
+            {
+                m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
+                break;
+            }
+
+            case Property::BackgroundColorCheckedDisabled:
+            {
+                m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
+                break;
+            }
+
+            case Property::TextDistanceRatio:
+            {
+                m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
+                break;
+            }
+
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteUnchecked.setOpacity(m_opacityCached);
+                m_spriteChecked.setOpacity(m_opacityCached);
+                m_spriteUncheckedHover.setOpacity(m_opacityCached);
+                m_spriteCheckedHover.setOpacity(m_opacityCached);
+                m_spriteUncheckedDisabled.setOpacity(m_opacityCached);
+                m_spriteCheckedDisabled.setOpacity(m_opacityCached);
+                m_spriteFocused.setOpacity(m_opacityCached);
+
+                m_text.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
+
+                m_text.setFont(m_fontCached);
+                setText(getText());
+                break;
+            }
+
+            default:
+            {
+                Widget::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -655,7 +735,7 @@ namespace tgui
             circle.setOutlineThickness(-m_bordersCached.getLeft());
             circle.setFillColor(Color::Transparent);
             circle.setOutlineColor(Color::calcColorOpacity(getCurrentBorderColor(), m_opacityCached));
-            target.draw(circle, states);
+            VertexBatch::draw(target, circle, states);
         }
 
         // Draw the box
@@ -689,7 +769,7 @@ namespace tgui
         {
             sf::CircleShape circle{innerRadius};
             circle.setFillColor(Color::calcColorOpacity(getCurrentBackgroundColor(), m_opacityCached));
-            target.draw(circle, states);
+            VertexBatch::draw(target, circle, states);
 
             // Draw the check if the radio button is checked
             if (m_checked)
@@ -697,7 +777,7 @@ namespace tgui
                 sf::CircleShape checkShape{innerRadius * 0.4f};
                 checkShape.setFillColor(Color::calcColorOpacity(getCurrentCheckColor(), m_opacityCached));
                 checkShape.setPosition({innerRadius - checkShape.getRadius(), innerRadius - checkShape.getRadius()});
-                target.draw(checkShape, states);
+                VertexBatch::draw(target, checkShape, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getLeft()});
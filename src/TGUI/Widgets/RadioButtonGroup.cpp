@@ -34,6 +34,8 @@ namespace tgui
     RadioButtonGroup::RadioButtonGroup()
     {
         m_type = "RadioButtonGroup";
+        m_batchableWidgetType = &typeid(RadioButtonGroup);
+        m_mouseOnWidgetInsideBoundsType = &typeid(RadioButtonGroup);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
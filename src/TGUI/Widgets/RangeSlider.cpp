@@ -37,6 +37,7 @@ namespace tgui
         m_type = "RangeSlider";
 
         m_draggableWidget = true;
+        m_batchableWidgetType = &typeid(RangeSlider);
 
         m_renderer = aurora::makeCopied<RangeSliderRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -107,7 +108,8 @@ namespace tgui
         else
             m_verticalScroll = false;
 
-        if (m_spriteTrack.isSet() && m_spriteThumb.isSet())
+        if (m_spriteTrack.isSet() && m_spriteThumb.isSet()
+         && (m_spriteTrack.getTexture().getImageSize().x > 0) && (m_spriteTrack.getTexture().getImageSize().y > 0))
         {
             float scaleFactor;
             if (m_verticalImage == m_verticalScroll)
@@ -197,6 +199,8 @@ namespace tgui
 
     void RangeSlider::setMinimum(float minimum)
     {
+        invalidate();
+
         const auto oldMinimum = m_minimum;
 
         // Set the new minimum
@@ -226,6 +230,8 @@ namespace tgui
 
     void RangeSlider::setMaximum(float maximum)
     {
+        invalidate();
+
         const auto oldMaximum = m_maximum;
 
         // Set the new maximum
@@ -255,6 +261,8 @@ namespace tgui
 
     void RangeSlider::setSelectionStart(float value)
     {
+        invalidate();
+
         // Round to nearest allowed value
         if (m_step != 0)
            value = m_minimum + (std::round((value - m_minimum) / m_step) * m_step);
@@ -290,6 +298,8 @@ namespace tgui
 
     void RangeSlider::setSelectionEnd(float value)
     {
+        invalidate();
+
         // Round to nearest allowed value
         if (m_step != 0)
            value = m_minimum + (std::round((value - m_minimum) / m_step) * m_step);
@@ -480,88 +490,127 @@ namespace tgui
 
     Signal& RangeSlider::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onRangeChange.getName()))
-            return onRangeChange;
+        static const auto signalMap = createSignalMap<RangeSlider>(*this, {
+                [](RangeSlider& widget) -> Signal& { return widget.onRangeChange; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return Widget::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RangeSlider::rendererChanged(const std::string& property)
+    void RangeSlider::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "texturetrack")
+        switch (property.getId())
         {
-            m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
 
-            if (m_spriteTrack.getTexture().getImageSize().x < m_spriteTrack.getTexture().getImageSize().y)
-                m_verticalImage = true;
-            else
-                m_verticalImage = false;
+            case Property::TextureTrack:
+            {
+                m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
 
-            setSize(m_size);
-        }
-        else if (property == "texturetrackhover")
-        {
-            m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
-        }
-        else if (property == "texturethumb")
-        {
-            m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            setSize(m_size);
-        }
-        else if (property == "texturethumbhover")
-        {
-            m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
-        }
-        else if (property == "trackcolor")
-        {
-            m_trackColorCached = getSharedRenderer()->getTrackColor();
-        }
-        else if (property == "trackcolorhover")
-        {
-            m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
-        }
-        else if (property == "selectedtrackcolor")
-        {
-            m_selectedTrackColorCached = getSharedRenderer()->getSelectedTrackColor();
-        }
-        else if (property == "selectedtrackcolorhover")
-        {
-            m_selectedTrackColorHoverCached = getSharedRenderer()->getSelectedTrackColorHover();
-        }
-        else if (property == "thumbcolor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == "thumbcolorhover")
-        {
-            m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "bordercolorhover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+                if (m_spriteTrack.getTexture().getImageSize().x < m_spriteTrack.getTexture().getImageSize().y)
+                    m_verticalImage = true;
+                else
+                    m_verticalImage = false;
 
-            m_spriteTrack.setOpacity(m_opacityCached);
-            m_spriteTrackHover.setOpacity(m_opacityCached);
-            m_spriteThumb.setOpacity(m_opacityCached);
-            m_spriteThumbHover.setOpacity(m_opacityCached);
+                setSize(m_size);
+                break;
+            }
+
+            case Property::TextureTrackHover:
+            {
+                m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
+                break;
+            }
+
+            case Property::TextureThumb:
+            {
+                m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
+                setSize(m_size);
+                break;
+            }
+
+            case Property::TextureThumbHover:
+            {
+                m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
+                break;
+            }
+
+            case Property::TrackColor:
+            {
+                m_trackColorCached = getSharedRenderer()->getTrackColor();
+                break;
+            }
+
+            case Property::TrackColorHover:
+            {
+                m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
+                break;
+            }
+
+            case Property::SelectedTrackColor:
+            {
+                m_selectedTrackColorCached = getSharedRenderer()->getSelectedTrackColor();
+                break;
+            }
+
+            case Property::SelectedTrackColorHover:
+            {
+                m_selectedTrackColorHoverCached = getSharedRenderer()->getSelectedTrackColorHover();
+                break;
+            }
+
+            case Property::ThumbColor:
+            {
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                break;
+            }
+
+            case Property::ThumbColorHover:
+            {
+                m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
+                break;
+            }
+
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case Property::BorderColorHover:
+            {
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+            }
+
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteTrack.setOpacity(m_opacityCached);
+                m_spriteTrackHover.setOpacity(m_opacityCached);
+                m_spriteThumb.setOpacity(m_opacityCached);
+                m_spriteThumbHover.setOpacity(m_opacityCached);
+                break;
+            }
+
+            default:
+            {
+                Widget::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -40,6 +40,8 @@ namespace tgui
         Panel{size}
     {
         m_type = "ScrollablePanel";
+        m_batchableWidgetType = &typeid(ScrollablePanel);
+        m_mouseOnWidgetInsideBoundsType = &typeid(ScrollablePanel);
 
         m_renderer = aurora::makeCopied<ScrollablePanelRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -381,9 +383,15 @@ namespace tgui
         m_mouseDown = true;
 
         if (m_verticalScrollbar.mouseOnWidget(pos - getPosition()))
+        {
             m_verticalScrollbar.leftMousePressed(pos - getPosition());
+            invalidate();
+        }
         else if (m_horizontalScrollbar.mouseOnWidget(pos - getPosition()))
+        {
             m_horizontalScrollbar.leftMousePressed(pos - getPosition());
+            invalidate();
+        }
         else if (FloatRect{getPosition().x + getChildWidgetsOffset().x, getPosition().y + getChildWidgetsOffset().y, getInnerSize().x, getInnerSize().y}.contains(pos))
         {
             Panel::leftMousePressed({pos.x + static_cast<float>(m_horizontalScrollbar.getValue()),
@@ -396,9 +404,15 @@ namespace tgui
     void ScrollablePanel::leftMouseReleased(Vector2f pos)
     {
         if (m_verticalScrollbar.mouseOnWidget(pos - getPosition()))
+        {
             m_verticalScrollbar.leftMouseReleased(pos - getPosition());
+            invalidate();
+        }
         else if (m_horizontalScrollbar.mouseOnWidget(pos - getPosition()))
+        {
             m_horizontalScrollbar.leftMouseReleased(pos - getPosition());
+            invalidate();
+        }
         else if (FloatRect{getPosition().x + getChildWidgetsOffset().x, getPosition().y + getChildWidgetsOffset().y, getInnerSize().x, getInnerSize().y}.contains(pos))
         {
             Panel::leftMouseReleased({pos.x + static_cast<float>(m_horizontalScrollbar.getValue()),
@@ -410,6 +424,8 @@ namespace tgui
 
     void ScrollablePanel::mouseMoved(Vector2f pos)
     {
+        const Vector2f oldContentOffset = getContentOffset();
+
         // Check if the mouse event should go to the scrollbar
         if ((m_verticalScrollbar.isMouseDown() && m_verticalScrollbar.isMouseDownOnThumb()) || m_verticalScrollbar.mouseOnWidget(pos - getPosition()))
         {
@@ -430,12 +446,20 @@ namespace tgui
             m_verticalScrollbar.mouseNoLongerOnWidget();
             m_horizontalScrollbar.mouseNoLongerOnWidget();
         }
+
+        // Everything has to be drawn again when dragging the thumb moved the child widgets
+        if (getContentOffset() != oldContentOffset)
+            invalidate();
+        else
+            invalidateScrollbars();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ScrollablePanel::mouseWheelScrolled(float delta, Vector2f pos)
     {
+        invalidate();
+
         if (m_horizontalScrollbar.isShown() && m_horizontalScrollbar.mouseOnWidget(pos - getPosition()))
         {
             m_horizontalScrollbar.mouseWheelScrolled(delta, pos - getPosition());
@@ -455,6 +479,7 @@ namespace tgui
         Panel::mouseNoLongerOnWidget();
         m_verticalScrollbar.mouseNoLongerOnWidget();
         m_horizontalScrollbar.mouseNoLongerOnWidget();
+        invalidateScrollbars();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -464,6 +489,16 @@ namespace tgui
         Panel::mouseNoLongerDown();
         m_verticalScrollbar.mouseNoLongerDown();
         m_horizontalScrollbar.mouseNoLongerDown();
+        invalidateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::invalidateChildRegion(FloatRect rect)
+    {
+        Panel::invalidateChildRegion({rect.left - static_cast<float>(m_horizontalScrollbar.getValue()),
+                                      rect.top - static_cast<float>(m_verticalScrollbar.getValue()),
+                                      rect.width, rect.height});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -520,15 +555,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ScrollablePanel::rendererChanged(const std::string& property)
+    void ScrollablePanel::rendererChanged(PropertyId property)
     {
-        if (property == "scrollbar")
+        switch (property.getId())
         {
-            m_verticalScrollbar.setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar.setRenderer(getSharedRenderer()->getScrollbar());
+            case Property::Scrollbar:
+            {
+                m_verticalScrollbar.setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar.setRenderer(getSharedRenderer()->getScrollbar());
+                break;
+            }
+
+            default:
+            {
+                Panel::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Panel::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -596,6 +639,8 @@ namespace tgui
 
     void ScrollablePanel::updateScrollbars()
     {
+        const Vector2f oldContentOffset = getContentOffset();
+
         const Vector2f scrollbarSpace = {getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
                                          getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()};
 
@@ -644,6 +689,26 @@ namespace tgui
 
         const float horizontalSpeed = 40.f * (static_cast<float>(m_horizontalScrollbar.getMaximum() - m_horizontalScrollbar.getLowValue()) / m_horizontalScrollbar.getLowValue());
         m_horizontalScrollbar.setScrollAmount(static_cast<unsigned int>(std::ceil(std::sqrt(horizontalSpeed))));
+
+        // The child widgets move when the value of a scrollbar had to be changed to fit the new maximum
+        if (getContentOffset() != oldContentOffset)
+            invalidate();
+        else
+            invalidateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::invalidateScrollbars()
+    {
+        if (!m_parent || !m_visible)
+            return;
+
+        for (const auto* scrollbar : {&m_verticalScrollbar, &m_horizontalScrollbar})
+        {
+            if (scrollbar->isShown())
+                m_parent->invalidateChildRegion({getPosition() + scrollbar->getPosition(), scrollbar->getSize()});
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/VertexBatch.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -37,6 +38,8 @@ namespace tgui
         m_type = "Scrollbar";
 
         m_draggableWidget = true;
+        m_batchableWidgetType = &typeid(Scrollbar);
+        m_mouseOnWidgetInsideBoundsType = &typeid(Scrollbar);
 
         m_renderer = aurora::makeCopied<ScrollbarRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -100,8 +103,10 @@ namespace tgui
         else
             m_verticalScroll = false;
 
+        // The arrow sizes can only be based on the images when their sizes are known (an image that failed to load has size 0)
         bool textured = false;
-        if (m_spriteTrack.isSet() && m_spriteThumb.isSet() && m_spriteArrowUp.isSet() && m_spriteArrowDown.isSet())
+        if (m_spriteTrack.isSet() && m_spriteThumb.isSet() && m_spriteArrowUp.isSet() && m_spriteArrowDown.isSet()
+         && (m_spriteArrowUp.getTexture().getImageSize().y > 0) && (m_spriteArrowDown.getTexture().getImageSize().y > 0))
             textured = true;
 
         if (m_verticalScroll)
@@ -228,6 +233,8 @@ namespace tgui
 
     void Scrollbar::setMaximum(unsigned int maximum)
     {
+        invalidate();
+
         // Set the new maximum
         if (maximum > 0)
             m_maximum = maximum;
@@ -255,6 +262,8 @@ namespace tgui
 
     void Scrollbar::setValue(unsigned int value)
     {
+        invalidate();
+
         // When the value is above the maximum then adjust it
         if (m_maximum < m_lowValue)
             value = 0;
@@ -283,6 +292,8 @@ namespace tgui
 
     void Scrollbar::setLowValue(unsigned int lowValue)
     {
+        invalidate();
+
         // Set the new value
         m_lowValue = lowValue;
 
@@ -321,6 +332,8 @@ namespace tgui
 
     void Scrollbar::setAutoHide(bool autoHide)
     {
+        invalidate();
+
         m_autoHide = autoHide;
     }
 
@@ -685,99 +698,144 @@ namespace tgui
 
     Signal& Scrollbar::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onValueChange.getName()))
-            return onValueChange;
+        static const auto signalMap = createSignalMap<Scrollbar>(*this, {
+                [](Scrollbar& widget) -> Signal& { return widget.onValueChange; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return Widget::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Scrollbar::rendererChanged(const std::string& property)
+    void Scrollbar::rendererChanged(PropertyId property)
     {
-        if (property == "texturetrack")
-        {
-            m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
-            setSize(m_size);
-        }
-        else if (property == "texturetrackhover")
-        {
-            m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
-        }
-        else if (property == "texturethumb")
-        {
-            m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            setSize(m_size);
-        }
-        else if (property == "texturethumbhover")
-        {
-            m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
-        }
-        else if (property == "texturearrowup")
-        {
-            m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
-            setSize(m_size);
-        }
-        else if (property == "texturearrowuphover")
-        {
-            m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
-        }
-        else if (property == "texturearrowdown")
-        {
-            m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
-            setSize(m_size);
-        }
-        else if (property == "texturearrowdownhover")
+        switch (property.getId())
         {
-            m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
-        }
-        else if (property == "trackcolor")
-        {
-            m_trackColorCached = getSharedRenderer()->getTrackColor();
-        }
-        else if (property == "trackcolorhover")
-        {
-            m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
-        }
-        else if (property == "thumbcolor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == "thumbcolorhover")
-        {
-            m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
-        }
-        else if (property == "arrowbackgroundcolor")
-        {
-            m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
-        }
-        else if (property == "arrowbackgroundcolorhover")
-        {
-            m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
-        }
-        else if (property == "arrowcolor")
-        {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
-        }
-        else if (property == "arrowcolorhover")
-        {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteTrack.setOpacity(m_opacityCached);
-            m_spriteTrackHover.setOpacity(m_opacityCached);
-            m_spriteThumb.setOpacity(m_opacityCached);
-            m_spriteThumbHover.setOpacity(m_opacityCached);
-            m_spriteArrowUp.setOpacity(m_opacityCached);
-            m_spriteArrowUpHover.setOpacity(m_opacityCached);
-            m_spriteArrowDown.setOpacity(m_opacityCached);
-            m_spriteArrowDownHover.setOpacity(m_opacityCached);
+            case Property::TextureTrack:
+            {
+                m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
+                setSize(m_size);
+                break;
+            }
+
+            case Property::TextureTrackHover:
+            {
+                m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
+                break;
+            }
+
+            case Property::TextureThumb:
+            {
+                m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
+                setSize(m_size);
+                break;
+            }
+
+            case Property::TextureThumbHover:
+            {
+                m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
+                break;
+            }
+
+            case Property::TextureArrowUp:
+            {
+                m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
+                setSize(m_size);
+                break;
+            }
+
+            case Property::TextureArrowUpHover:
+            {
+                m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
+                break;
+            }
+
+            case Property::TextureArrowDown:
+            {
+                m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
+                setSize(m_size);
+                break;
+            }
+
+            case Property::TextureArrowDownHover:
+            {
+                m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
+                break;
+            }
+
+            case Property::TrackColor:
+            {
+                m_trackColorCached = getSharedRenderer()->getTrackColor();
+                break;
+            }
+
+            case Property::TrackColorHover:
+            {
+                m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
+                break;
+            }
+
+            case Property::ThumbColor:
+            {
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                break;
+            }
+
+            case Property::ThumbColorHover:
+            {
+                m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
+                break;
+            }
+
+            case Property::ArrowBackgroundColor:
+            {
+                m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
+                break;
+            }
+
+            case Property::ArrowBackgroundColorHover:
+            {
+                m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
+                break;
+            }
+
+            case Property::ArrowColor:
+            {
+                m_arrowColorCached = getSharedRenderer()->getArrowColor();
+                break;
+            }
+
+            case Property::ArrowColorHover:
+            {
+                m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+                break;
+            }
+
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteTrack.setOpacity(m_opacityCached);
+                m_spriteTrackHover.setOpacity(m_opacityCached);
+                m_spriteThumb.setOpacity(m_opacityCached);
+                m_spriteThumbHover.setOpacity(m_opacityCached);
+                m_spriteArrowUp.setOpacity(m_opacityCached);
+                m_spriteArrowUpHover.setOpacity(m_opacityCached);
+                m_spriteArrowDown.setOpacity(m_opacityCached);
+                m_spriteArrowDownHover.setOpacity(m_opacityCached);
+                break;
+            }
+
+            default:
+            {
+                Widget::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -877,7 +935,7 @@ namespace tgui
                 arrow.setPoint(2, {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5});
             }
 
-            target.draw(arrow, states);
+            VertexBatch::draw(target, arrow, states);
         }
 
         // Draw the track
@@ -951,7 +1009,7 @@ namespace tgui
                 arrow.setPoint(2, {m_arrowDown.width / 5, m_arrowDown.height * 4/5});
             }
 
-            target.draw(arrow, states);
+            VertexBatch::draw(target, arrow, states);
         }
     }
 
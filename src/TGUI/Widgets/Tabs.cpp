@@ -39,6 +39,8 @@ namespace tgui
     Tabs::Tabs()
     {
         m_type = "Tabs";
+        m_batchableWidgetType = &typeid(Tabs);
+        m_mouseOnWidgetInsideBoundsType = &typeid(Tabs);
         m_distanceToSideCached = Text::getLineHeight(m_fontCached, getGlobalTextSize()) * 0.4f;
 
         m_renderer = aurora::makeCopied<TabsRenderer>();
@@ -108,6 +110,8 @@ namespace tgui
 
     void Tabs::setAutoSize(bool autoSize)
     {
+        invalidate();
+
         if (m_autoSize != autoSize)
         {
             m_autoSize = autoSize;
@@ -137,6 +141,8 @@ namespace tgui
 
     void Tabs::insert(std::size_t index, const sf::String& text, bool selectTab)
     {
+        invalidate();
+
         // If the index is too high then just insert at the end
         if (index > m_tabWidth.size())
             index = m_tabWidth.size();
@@ -177,6 +183,8 @@ namespace tgui
 
     bool Tabs::changeText(std::size_t index, const sf::String& text)
     {
+        invalidate();
+
         if (index >= m_tabTexts.size())
             return false;
 
@@ -204,6 +212,8 @@ namespace tgui
 
     void Tabs::select(std::size_t index)
     {
+        invalidate();
+
         // If the index is too big then do nothing
         if (index > m_tabTexts.size() - 1)
             return;
@@ -227,6 +237,8 @@ namespace tgui
 
     void Tabs::deselect()
     {
+        invalidate();
+
         if (m_selectedTab >= 0)
             m_tabTexts[m_selectedTab].setColor(m_textColorCached);
 
@@ -251,6 +263,8 @@ namespace tgui
 
     void Tabs::remove(std::size_t index)
     {
+        invalidate();
+
         // The index can't be too high
         if (index > m_tabTexts.size() - 1)
             return;
@@ -273,6 +287,8 @@ namespace tgui
 
     void Tabs::removeAll()
     {
+        invalidate();
+
         m_tabTexts.clear();
         m_tabWidth.clear();
         m_selectedTab = -1;
@@ -302,6 +318,8 @@ namespace tgui
 
     void Tabs::setTextSize(unsigned int size)
     {
+        invalidate();
+
         if ((size == 0) || (m_requestedTextSize != size))
         {
             m_requestedTextSize = size;
@@ -329,6 +347,8 @@ namespace tgui
 
     void Tabs::setTabHeight(float height)
     {
+        invalidate();
+
         Widget::setSize({getSizeLayout().x, height});
         m_bordersCached.updateParentSize(getSize());
 
@@ -341,6 +361,8 @@ namespace tgui
 
     void Tabs::setMaximumTabWidth(float maximumWidth)
     {
+        invalidate();
+
         m_maximumTabWidth = maximumWidth;
 
         recalculateTabsWidth();
@@ -357,6 +379,8 @@ namespace tgui
 
     void Tabs::setMinimumTabWidth(float minimumWidth)
     {
+        invalidate();
+
         m_minimumTabWidth = minimumWidth;
 
         recalculateTabsWidth();
@@ -481,99 +505,140 @@ namespace tgui
 
     Signal& Tabs::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onTabSelect.getName()))
-            return onTabSelect;
+        static const auto signalMap = createSignalMap<Tabs>(*this, {
+                [](Tabs& widget) -> Signal& { return widget.onTabSelect; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return Widget::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Tabs::rendererChanged(const std::string& property)
+    void Tabs::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            recalculateTabsWidth();
-        }
-        else if (property == "textcolor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors();
-        }
-        else if (property == "textcolorhover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateTextColors();
-        }
-        else if (property == "selectedtextcolor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors();
-        }
-        else if (property == "selectedtextcolorhover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateTextColors();
-        }
-        else if (property == "texturetab")
-        {
-            m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
-        }
-        else if (property == "textureselectedtab")
-        {
-            m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
-        }
-        else if (property == "distancetoside")
+        switch (property.getId())
         {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-            recalculateTabsWidth();
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "backgroundcolorhover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == "selectedbackgroundcolor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == "selectedbackgroundcolorhover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                recalculateTabsWidth();
+                break;
+            }
 
-            m_spriteTab.setOpacity(m_opacityCached);
-            m_spriteSelectedTab.setOpacity(m_opacityCached);
+            case Property::TextColor:
+            {
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateTextColors();
+                break;
+            }
 
-            for (auto& tabText : m_tabTexts)
-                tabText.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
+            case Property::TextColorHover:
+            {
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateTextColors();
+                break;
+            }
+
+            case Property::SelectedTextColor:
+            {
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateTextColors();
+                break;
+            }
 
-            for (auto& tab : m_tabTexts)
-                tab.setFont(m_fontCached);
+            case Property::SelectedTextColorHover:
+            {
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateTextColors();
+                break;
+            }
 
-            // Recalculate the size when the text is auto sizing
-            if (m_requestedTextSize == 0)
-                setTextSize(0);
-            else
+            case Property::TextureTab:
+            {
+                m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
+                break;
+            }
+
+            case Property::TextureSelectedTab:
+            {
+                m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
+                break;
+            }
+
+            case Property::DistanceToSide:
+            {
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
                 recalculateTabsWidth();
+                break;
+            }
+
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case Property::BackgroundColorHover:
+            {
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+            }
+
+            case Property::SelectedBackgroundColor:
+            {
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+            }
+
+            case Property::SelectedBackgroundColorHover:
+            {
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+            }
+
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                m_spriteTab.setOpacity(m_opacityCached);
+                m_spriteSelectedTab.setOpacity(m_opacityCached);
+
+                for (auto& tabText : m_tabTexts)
+                    tabText.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
+
+                for (auto& tab : m_tabTexts)
+                    tab.setFont(m_fontCached);
+
+                // Recalculate the size when the text is auto sizing
+                if (m_requestedTextSize == 0)
+                    setTextSize(0);
+                else
+                    recalculateTabsWidth();
+                break;
+            }
+
+            default:
+            {
+                Widget::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,7 +27,9 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/GlyphMetrics.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -40,6 +42,8 @@ namespace tgui
     {
         m_type = "TextBox";
         m_draggableWidget = true;
+        m_batchableWidgetType = &typeid(TextBox);
+        m_mouseOnWidgetInsideBoundsType = &typeid(TextBox);
         m_textBeforeSelection.setFont(m_fontCached);
         m_textSelection1.setFont(m_fontCached);
         m_textSelection2.setFont(m_fontCached);
@@ -130,6 +134,8 @@ namespace tgui
 
     void TextBox::setText(const sf::String& text)
     {
+        invalidate();
+
         // Remove all the excess characters when a character limit is set
         if ((m_maxChars > 0) && (text.getSize() > m_maxChars))
             m_text = text.substring(0, m_maxChars);
@@ -168,6 +174,8 @@ namespace tgui
 
     void TextBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Store the new text size
         m_textSize = size;
         if (m_textSize < 1)
@@ -199,6 +207,8 @@ namespace tgui
 
     void TextBox::setMaximumCharacters(std::size_t maxChars)
     {
+        invalidate();
+
         // Set the new character limit ( 0 to disable the limit )
         m_maxChars = maxChars;
 
@@ -222,6 +232,8 @@ namespace tgui
 
     void TextBox::setVerticalScrollbarPresent(bool present)
     {
+        invalidate();
+
         if (present)
         {
             m_verticalScroll.show();
@@ -245,6 +257,8 @@ namespace tgui
 
     void TextBox::setCaretPosition(std::size_t charactersBeforeCaret)
     {
+        invalidate();
+
         // The caret position has to stay inside the string
         if (charactersBeforeCaret > m_text.getSize())
             charactersBeforeCaret = m_text.getSize();
@@ -282,6 +296,8 @@ namespace tgui
 
     void TextBox::setReadOnly(bool readOnly)
     {
+        invalidate();
+
         m_readOnly = readOnly;
     }
 
@@ -773,7 +789,7 @@ namespace tgui
                         m_selStart = m_selEnd;
 
                         m_text.erase(pos - 1, 1);
-                        rearrangeText(true);
+                        rearrangeText(true, pos - 1, 1, 0);
                     }
                 }
                 else // When you did select some characters then delete them
@@ -795,8 +811,12 @@ namespace tgui
                 // Check that we did not select any characters
                 if (m_selStart == m_selEnd)
                 {
-                    m_text.erase(findTextSelectionPositions().second, 1);
-                    rearrangeText(true);
+                    const std::size_t pos = findTextSelectionPositions().second;
+                    if (pos < m_text.getSize())
+                    {
+                        m_text.erase(pos, 1);
+                        rearrangeText(true, pos, 1, 0);
+                    }
                 }
                 else // You did select some characters, so remove them
                     deleteSelectedCharacters();
@@ -855,12 +875,12 @@ namespace tgui
                     {
                         deleteSelectedCharacters();
 
-                        m_text.insert(findTextSelectionPositions().first, clipboardContents);
-                        m_lines[m_selStart.y].insert(m_selStart.x, clipboardContents);
+                        const std::size_t pos = findTextSelectionPositions().first;
+                        m_text.insert(pos, clipboardContents);
 
                         m_selStart.x += clipboardContents.getSize();
                         m_selEnd = m_selStart;
-                        rearrangeText(true);
+                        rearrangeText(true, pos, 0, clipboardContents.getSize());
 
                         onTextChange.emit(this, m_text);
                     }
@@ -896,7 +916,6 @@ namespace tgui
             const std::size_t caretPosition = findTextSelectionPositions().first;
 
             m_text.insert(caretPosition, key);
-            m_lines[m_selEnd.y].insert(m_selEnd.x, key);
 
             // Increment the caret position, unless you type a newline at the start of a line while that line only existed due to word wrapping
             if ((key != '\n') || (m_selEnd.x > 0) || (m_selEnd.y == 0) || m_lines[m_selEnd.y-1].isEmpty() || (m_text[caretPosition-1] == '\n'))
@@ -905,7 +924,7 @@ namespace tgui
                 m_selEnd.x++;
             }
 
-            rearrangeText(true);
+            rearrangeText(true, caretPosition, 0, 1);
         };
 
         // If there is a scrollbar then inserting can't go wrong
@@ -1014,32 +1033,24 @@ namespace tgui
             return sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
 
         // Find between which character the mouse is standing
-        float width = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-        std::uint32_t prevChar = 0;
-        for (std::size_t i = 0; i < m_lines[lineNumber].getSize(); ++i)
+        const sf::String& line = m_lines[lineNumber];
+        const auto metrics = GlyphMetrics::get(m_fontCached, getTextSize(), false);
+        if (!metrics)
+            return {0, lineNumber};
+
+        std::vector<float> offsets;
+        metrics->getCharacterOffsets(line, offsets);
+
+        // The right side of a character, including its kerning with the previous character, is stored in the next offset
+        const float posX = position.x - Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        const std::size_t i = static_cast<std::size_t>(std::upper_bound(offsets.begin() + 1, offsets.end(), posX) - offsets.begin()) - 1;
+        if (i < line.getSize())
         {
-            float charWidth;
-            const std::uint32_t curChar = m_lines[lineNumber][i];
-            //if (curChar == '\n')
-            //    return sf::Vector2f<std::size_t>(m_lines[lineNumber].getSize() - 1, lineNumber); // TextBox strips newlines but this code is kept for when this function is generalized
-            //else
-            if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', getTextSize(), false).advance) * 4;
+            const float kerning = metrics->getKerning((i > 0) ? line[i - 1] : 0, line[i]);
+            if (posX < offsets[i] + kerning + (metrics->getAdvance(line[i]) / 2.0f))
+                return {i, lineNumber};
             else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, getTextSize(), false).advance);
-
-            const float kerning = static_cast<float>(m_fontCached.getKerning(prevChar, curChar, getTextSize()));
-            if (width + charWidth + kerning <= position.x)
-                width += charWidth + kerning;
-            else
-            {
-                if (position.x < width + kerning + (charWidth / 2.0f))
-                    return {i, lineNumber};
-                else
-                    return {i + 1, lineNumber};
-            }
-
-            prevChar = curChar;
+                return {i + 1, lineNumber};
         }
 
         // You clicked behind the last character
@@ -1050,6 +1061,9 @@ namespace tgui
 
     std::pair<std::size_t, std::size_t> TextBox::findTextSelectionPositions() const
     {
+        if (!m_lines.empty() && (m_lineStartPositions.size() == m_lines.size()))
+            return {m_lineStartPositions[m_selStart.y] + m_selStart.x, m_lineStartPositions[m_selEnd.y] + m_selEnd.x};
+
         // This function is used to count the amount of characters spread over several lines
         auto findIndex = [this](std::size_t line)
         {
@@ -1079,24 +1093,39 @@ namespace tgui
             {
                 m_text.erase(textSelectionPositions.second, textSelectionPositions.first - textSelectionPositions.second);
                 m_selStart = m_selEnd;
+                rearrangeText(true, textSelectionPositions.second, textSelectionPositions.first - textSelectionPositions.second, 0);
             }
             else
             {
                 m_text.erase(textSelectionPositions.first, textSelectionPositions.second - textSelectionPositions.first);
                 m_selEnd = m_selStart;
+                rearrangeText(true, textSelectionPositions.first, textSelectionPositions.second - textSelectionPositions.first, 0);
             }
-
-            rearrangeText(true);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::rearrangeText(bool keepSelection)
+    {
+        // The whole text is treated as if it was replaced
+        std::size_t oldTextSize = 0;
+        if (!m_lines.empty() && (m_lineStartPositions.size() == m_lines.size()))
+            oldTextSize = m_lineStartPositions.back() + m_lines.back().getSize();
+
+        rearrangeText(keepSelection, 0, oldTextSize, m_text.getSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::rearrangeText(bool keepSelection, std::size_t changePosition, std::size_t removedCount, std::size_t insertedCount)
     {
         // Don't continue when line height is 0 or when there is no font yet
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
+        {
+            m_lineStartPositions.clear();
             return;
+        }
 
         // Find the maximum width of one line
         const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
@@ -1106,84 +1135,112 @@ namespace tgui
 
         // Don't do anything when there is no room for the text
         if (maxLineWidth <= 0)
+        {
+            m_lineStartPositions.clear();
             return;
+        }
 
         // Store the current selection position when we are keeping the selection
         std::pair<std::size_t, std::size_t> textSelectionPositions;
         if (keepSelection)
             textSelectionPositions = findTextSelectionPositions();
 
-        // Fit the text in the available space
-        const sf::String string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSize, false, false);
-
-        // Split the string in multiple lines
-        m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != sf::String::InvalidPos)
+        // Find the lines of the paragraphs that were changed. When the lines are no longer known then everything is recalculated.
+        std::size_t firstLine = 0;
+        std::size_t lastLine = m_lines.size();
+        std::size_t paragraphsStart = 0;
+        std::size_t paragraphsEnd = m_text.getSize();
+        if (m_lineStartPositions.size() != m_lines.size())
+            m_lineStartPositions.assign(m_lines.size(), 0);
+        else if (!m_lines.empty())
         {
-            newLinePos = string.find('\n', searchPosStart);
+            // A line ends in the middle of a paragraph when the next line starts immediately after it (no newline in between)
+            auto isWrappedLine = [this](std::size_t line){
+                    return (line + 1 < m_lines.size()) && (m_lineStartPositions[line + 1] == m_lineStartPositions[line] + m_lines[line].getSize());
+                };
+
+            firstLine = findLineOfTextPosition(changePosition);
+            while ((firstLine > 0) && isWrappedLine(firstLine - 1))
+                --firstLine;
+
+            lastLine = findLineOfTextPosition(changePosition + removedCount);
+            while (isWrappedLine(lastLine))
+                ++lastLine;
+
+            paragraphsStart = m_lineStartPositions[firstLine];
+            paragraphsEnd = m_lineStartPositions[lastLine] + m_lines[lastLine].getSize() + insertedCount - removedCount;
+            ++lastLine;
+        }
 
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.push_back(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.push_back(string.substring(searchPosStart));
+        // Fit the changed text in the available space
+        const sf::String paragraphs = m_text.substring(paragraphsStart, paragraphsEnd - paragraphsStart);
+        const std::vector<std::size_t> lineBreaks = Text::findLineBreaks(maxLineWidth, paragraphs, m_fontCached, m_textSize, false, false);
+
+        // Split the string in multiple lines, without the newlines in the text
+        std::vector<sf::String> newLines;
+        std::vector<std::size_t> newLineStartPositions;
+        for (std::size_t i = 0; i <= lineBreaks.size(); ++i)
+        {
+            const std::size_t lineStart = (i > 0) ? lineBreaks[i-1] : 0;
+            std::size_t lineEnd = (i < lineBreaks.size()) ? lineBreaks[i] : paragraphs.getSize();
+            if ((lineEnd > lineStart) && (paragraphs[lineEnd-1] == '\n'))
+                --lineEnd;
 
-            searchPosStart = newLinePos + 1;
+            newLines.push_back(paragraphs.substring(lineStart, lineEnd - lineStart));
+            newLineStartPositions.push_back(paragraphsStart + lineStart);
         }
 
+        // Replace the lines of the changed paragraphs and move the lines behind them
+        for (std::size_t i = lastLine; i < m_lineStartPositions.size(); ++i)
+            m_lineStartPositions[i] = m_lineStartPositions[i] + insertedCount - removedCount;
+
+        m_lines.erase(m_lines.begin() + firstLine, m_lines.begin() + lastLine);
+        m_lines.insert(m_lines.begin() + firstLine, newLines.begin(), newLines.end());
+        m_lineStartPositions.erase(m_lineStartPositions.begin() + firstLine, m_lineStartPositions.begin() + lastLine);
+        m_lineStartPositions.insert(m_lineStartPositions.begin() + firstLine, newLineStartPositions.begin(), newLineStartPositions.end());
+
         // Check if we should try to keep our selection
+        const sf::Vector2<std::size_t> endOfText{m_lines.back().getSize(), m_lines.size()-1};
         if (keepSelection)
         {
-            std::size_t index = 0;
-            sf::Vector2<std::size_t> newSelStart;
-            sf::Vector2<std::size_t> newSelEnd;
-            bool newSelStartFound = false;
-            bool newSelEndFound = false;
-
-            // Look for the new locations of our selection
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
+            // Find the first line that ends at or behind the position in the text (binary search, the line ends are sorted)
+            auto findLinePosition = [this](std::size_t position, sf::Vector2<std::size_t>& linePosition)
             {
-                index += m_lines[i].getSize();
-
-                if (!newSelStartFound && (index >= textSelectionPositions.first))
+                std::size_t low = 0;
+                std::size_t high = m_lines.size();
+                while (low < high)
                 {
-                    newSelStart = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - textSelectionPositions.first), i);
-
-                    newSelStartFound = true;
-                    if (newSelEndFound)
-                        break;
+                    const std::size_t middle = low + (high - low) / 2;
+                    if (m_lineStartPositions[middle] + m_lines[middle].getSize() < position)
+                        low = middle + 1;
+                    else
+                        high = middle;
                 }
 
-                if (!newSelEndFound && (index >= textSelectionPositions.second))
-                {
-                    newSelEnd = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - textSelectionPositions.second), i);
-
-                    newSelEndFound = true;
-                    if (newSelStartFound)
-                        break;
-                }
+                if (low == m_lines.size())
+                    return false;
 
-                // Skip newlines in the text
-                if (m_text[index] == '\n')
-                    ++index;
-            }
+                linePosition = {position - m_lineStartPositions[low], low};
+                return true;
+            };
 
             // Keep the selection when possible
-            if (newSelStartFound && newSelEndFound)
+            sf::Vector2<std::size_t> newSelStart;
+            sf::Vector2<std::size_t> newSelEnd;
+            if (findLinePosition(textSelectionPositions.first, newSelStart) && findLinePosition(textSelectionPositions.second, newSelEnd))
             {
                 m_selStart = newSelStart;
                 m_selEnd = newSelEnd;
             }
             else // The text has changed too much, the selection can't be kept
             {
-                m_selStart = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
+                m_selStart = endOfText;
                 m_selEnd = m_selStart;
             }
         }
         else // Set the caret at the back of the text
         {
-            m_selStart = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
+            m_selStart = endOfText;
             m_selEnd = m_selStart;
         }
 
@@ -1206,16 +1263,63 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t TextBox::findLineOfTextPosition(std::size_t position) const
+    {
+        const auto it = std::upper_bound(m_lineStartPositions.begin(), m_lineStartPositions.end(), position);
+        if (it == m_lineStartPositions.begin())
+            return 0;
+        else
+            return static_cast<std::size_t>(it - m_lineStartPositions.begin()) - 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::updateSelectionTexts()
     {
+        // Check if the caret is located above or below the view
+        if (isVerticalScrollbarPresent())
+        {
+            if (m_selEnd.y <= m_topLine)
+                m_verticalScroll.setValue(static_cast<unsigned int>(m_selEnd.y * m_lineHeight));
+            else if (m_selEnd.y + 1 >= m_topLine + m_visibleLines)
+                m_verticalScroll.setValue(static_cast<unsigned int>(((m_selEnd.y + 1) * m_lineHeight)
+                                                                    + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)
+                                                                    + Text::getExtraVerticalPadding(m_textSize)
+                                                                    - m_verticalScroll.getLowValue()));
+        }
+
+        // The lines or the selection have changed, so the texts always have to be updated
+        m_displayedLinesEnd = 0;
+        recalculateVisibleLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateDisplayedTexts()
+    {
+        // Only the visible lines and about a page above and below them are put in the texts, so that the amount of vertices
+        // that have to be created doesn't depend on the length of the text
+        const std::size_t extraLines = std::max<std::size_t>(m_visibleLines, 1);
+        m_displayedLinesStart = (m_topLine > extraLines) ? m_topLine - extraLines : 0;
+        m_displayedLinesEnd = std::min(m_topLine + m_visibleLines + extraLines, m_lines.size());
+
+        auto isDisplayed = [this](std::size_t line){
+                return (line >= m_displayedLinesStart) && (line < m_displayedLinesEnd);
+            };
+
+        // Combines the displayed lines that lie between the given lines
+        auto getDisplayedLines = [this](std::size_t firstLine, std::size_t lastLine){
+                sf::String string;
+                for (std::size_t i = std::max(firstLine, m_displayedLinesStart); i < std::min(lastLine, m_displayedLinesEnd); ++i)
+                    string += m_lines[i] + "\n";
+
+                return string;
+            };
+
         // If there is no selection then just put the whole text in m_textBeforeSelection
         if (m_selStart == m_selEnd)
         {
-            sf::String displayedText;
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-                displayedText += m_lines[i] + "\n";
-
-            m_textBeforeSelection.setString(displayedText);
+            m_textBeforeSelection.setString(getDisplayedLines(0, m_lines.size()));
             m_textSelection1.setString("");
             m_textSelection2.setString("");
             m_textAfterSelection1.setString("");
@@ -1230,59 +1334,45 @@ namespace tgui
                 std::swap(selectionStart, selectionEnd);
 
             // Set the text before the selection
-            if (selectionStart.y > 0)
             {
-                sf::String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + "\n";
+                sf::String string = getDisplayedLines(0, selectionStart.y);
+                if (isDisplayed(selectionStart.y))
+                    string += m_lines[selectionStart.y].substring(0, selectionStart.x);
 
-                string += m_lines[selectionStart.y].substring(0, selectionStart.x);
                 m_textBeforeSelection.setString(string);
             }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substring(0, selectionStart.x));
 
             // Set the selected text
             if (m_selStart.y == m_selEnd.y)
             {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
+                if (isDisplayed(selectionStart.y))
+                    m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
+                else
+                    m_textSelection1.setString("");
+
                 m_textSelection2.setString("");
             }
             else
             {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, m_lines[selectionStart.y].getSize() - selectionStart.x));
-
-                sf::String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + "\n";
+                if (isDisplayed(selectionStart.y))
+                    m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, m_lines[selectionStart.y].getSize() - selectionStart.x));
+                else
+                    m_textSelection1.setString("");
 
-                string += m_lines[selectionEnd.y].substring(0, selectionEnd.x);
+                sf::String string = getDisplayedLines(selectionStart.y + 1, selectionEnd.y);
+                if (isDisplayed(selectionEnd.y))
+                    string += m_lines[selectionEnd.y].substring(0, selectionEnd.x);
 
                 m_textSelection2.setString(string);
             }
 
             // Set the text after the selection
-            {
+            if (isDisplayed(selectionEnd.y))
                 m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x, m_lines[selectionEnd.y].getSize() - selectionEnd.x));
+            else
+                m_textAfterSelection1.setString("");
 
-                sf::String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + "\n";
-
-                m_textAfterSelection2.setString(string);
-            }
-        }
-
-        // Check if the caret is located above or below the view
-        if (isVerticalScrollbarPresent())
-        {
-            if (m_selEnd.y <= m_topLine)
-                m_verticalScroll.setValue(static_cast<unsigned int>(m_selEnd.y * m_lineHeight));
-            else if (m_selEnd.y + 1 >= m_topLine + m_visibleLines)
-                m_verticalScroll.setValue(static_cast<unsigned int>(((m_selEnd.y + 1) * m_lineHeight)
-                                                                    + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)
-                                                                    + Text::getExtraVerticalPadding(m_textSize)
-                                                                    - m_verticalScroll.getLowValue()));
+            m_textAfterSelection2.setString(getDisplayedLines(selectionEnd.y + 1, m_lines.size()));
         }
 
         recalculatePositions();
@@ -1311,6 +1401,10 @@ namespace tgui
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
 
+            // The caret is only drawn when the widget is focused
+            if (m_focused)
+                invalidate();
+
             // Too slow for double clicking
             m_possibleDoubleClick = false;
         }
@@ -1339,7 +1433,7 @@ namespace tgui
 
         // Calculate the position of the text objects
         m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
+        m_textBeforeSelection.setPosition({textOffset, static_cast<float>(m_displayedLinesStart * m_lineHeight)});
         if (m_selStart != m_selEnd)
         {
             auto selectionStart = m_selStart;
@@ -1359,23 +1453,23 @@ namespace tgui
             if (selectionStart.x > 0)
             {
                 m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+                                              static_cast<float>(selectionStart.y * m_lineHeight)});
             }
             else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+                m_textSelection1.setPosition({textOffset, static_cast<float>(selectionStart.y * m_lineHeight)});
 
-            m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
+            m_textSelection2.setPosition({textOffset, static_cast<float>(std::max(selectionStart.y + 1, m_displayedLinesStart) * m_lineHeight)});
 
-            if (!m_textSelection2.getString().isEmpty() || (selectionEnd.x == 0))
+            if (selectionStart.y != selectionEnd.y)
             {
                 m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
+                                                   static_cast<float>(selectionEnd.y * m_lineHeight)});
             }
             else
                 m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x + kerningSelectionEnd,
                                                    m_textSelection1.getPosition().y});
 
-            m_textAfterSelection2.setPosition({textOffset, static_cast<float>((selectionEnd.y + 1) * m_lineHeight)});
+            m_textAfterSelection2.setPosition({textOffset, static_cast<float>(std::max(selectionEnd.y + 1, m_displayedLinesStart) * m_lineHeight)});
 
             // Recalculate the selection rectangles
             {
@@ -1390,7 +1484,8 @@ namespace tgui
                         m_selectionRects.back().width += kerningSelectionEnd;
                 }
 
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
+                // Lines that aren't displayed don't need a selection rectangle
+                for (std::size_t i = std::max(selectionStart.y + 1, m_displayedLinesStart); i < std::min(selectionEnd.y, m_displayedLinesEnd); ++i)
                 {
                     m_selectionRects.back().width += textOffset;
                     m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(i * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
@@ -1417,8 +1512,6 @@ namespace tgui
                 }
             }
         }
-
-        recalculateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1443,96 +1536,137 @@ namespace tgui
             m_topLine = 0;
             m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) / m_lineHeight), m_lines.size());
         }
+
+        // Update the texts when lines became visible that weren't part of them yet
+        if ((m_displayedLinesEnd == 0) || (m_topLine < m_displayedLinesStart) || (m_topLine + m_visibleLines > m_displayedLinesEnd))
+            updateDisplayedTexts();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Signal& TextBox::getSignal(std::string signalName)
     {
-        if (signalName == toLower(onTextChange.getName()))
-            return onTextChange;
+        static const auto signalMap = createSignalMap<TextBox>(*this, {
+                [](TextBox& widget) -> Signal& { return widget.onTextChange; }
+            });
+
+        const auto it = signalMap.find(signalName);
+        if (it != signalMap.end())
+            return it->second(*this);
         else
             return Widget::getSignal(std::move(signalName));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::rendererChanged(const std::string& property)
+    void TextBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == "padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == "textcolor")
-        {
-            m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == "selectedtextcolor")
+        switch (property.getId())
         {
-            m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
-            m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
-        }
-        else if (property == "texturebackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == "scrollbar")
-        {
-            m_verticalScroll.setRenderer(getSharedRenderer()->getScrollbar());
-        }
-        else if (property == "backgroundcolor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == "selectedtextbackgroundcolor")
-        {
-            m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
-        }
-        else if (property == "bordercolor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == "caretcolor")
-        {
-            m_caretColorCached = getSharedRenderer()->getCaretColor();
-        }
-        else if (property == "caretwidth")
-        {
-            m_caretWidthCached = getSharedRenderer()->getCaretWidth();
-        }
-        else if (property == "opacity")
-        {
-            Widget::rendererChanged(property);
-
-            m_verticalScroll.setInheritedOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection1.setOpacity(m_opacityCached);
-            m_textAfterSelection2.setOpacity(m_opacityCached);
-            m_textSelection1.setOpacity(m_opacityCached);
-            m_textSelection2.setOpacity(m_opacityCached);
-        }
-        else if (property == "font")
-        {
-            Widget::rendererChanged(property);
-
-            m_textBeforeSelection.setFont(m_fontCached);
-            m_textSelection1.setFont(m_fontCached);
-            m_textSelection2.setFont(m_fontCached);
-            m_textAfterSelection1.setFont(m_fontCached);
-            m_textAfterSelection2.setFont(m_fontCached);
-            setTextSize(getTextSize());
+            case Property::Borders:
+            {
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+            }
+
+            case Property::Padding:
+            {
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+            }
+
+            case Property::TextColor:
+            {
+                m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
+                m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
+                m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
+                break;
+            }
+
+            case Property::SelectedTextColor:
+            {
+                m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
+                m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
+                break;
+            }
+
+            case Property::TextureBackground:
+            {
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+            }
+
+            case Property::Scrollbar:
+            {
+                m_verticalScroll.setRenderer(getSharedRenderer()->getScrollbar());
+                break;
+            }
+
+            case Property::BackgroundColor:
+            {
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+            }
+
+            case Property::SelectedTextBackgroundColor:
+            {
+                m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
+                break;
+            }
+
+            case Property::BorderColor:
+            {
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+            }
+
+            case Property::CaretColor:
+            {
+                m_caretColorCached = getSharedRenderer()->getCaretColor();
+                break;
+            }
+
+            case Property::CaretWidth:
+            {
+                m_caretWidthCached = getSharedRenderer()->getCaretWidth();
+                break;
+            }
+
+            case Property::Opacity:
+            {
+                Widget::rendererChanged(property);
+
+                m_verticalScroll.setInheritedOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_textBeforeSelection.setOpacity(m_opacityCached);
+                m_textAfterSelection1.setOpacity(m_opacityCached);
+                m_textAfterSelection2.setOpacity(m_opacityCached);
+                m_textSelection1.setOpacity(m_opacityCached);
+                m_textSelection2.setOpacity(m_opacityCached);
+                break;
+            }
+
+            case Property::Font:
+            {
+                Widget::rendererChanged(property);
+
+                m_textBeforeSelection.setFont(m_fontCached);
+                m_textSelection1.setFont(m_fontCached);
+                m_textSelection2.setFont(m_fontCached);
+                m_textAfterSelection1.setFont(m_fontCached);
+                m_textAfterSelection2.setFont(m_fontCached);
+                setTextSize(getTextSize());
+                break;
+            }
+
+            default:
+            {
+                Widget::rendererChanged(property);
+                break;
+            }
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -36,6 +36,8 @@ namespace tgui
         BoxLayoutRatios{size}
     {
         m_type = "VerticalLayout";
+        m_batchableWidgetType = &typeid(VerticalLayout);
+        m_mouseOnWidgetInsideBoundsType = &typeid(VerticalLayout);
 
         m_renderer = aurora::makeCopied<BoxLayoutRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -24,6 +24,20 @@
 
 #include "Tests.hpp"
 #include <TGUI/TGUI.hpp>
+#include <numeric>
+
+namespace
+{
+    // A widget that can also be clicked outside its bounds, because it overrides mouseOnWidget
+    class LargeClickableWidget : public tgui::ClickableWidget
+    {
+    public:
+        bool mouseOnWidget(tgui::Vector2f pos) const override
+        {
+            return tgui::FloatRect{getPosition().x, getPosition().y, 100, 100}.contains(pos);
+        }
+    };
+}
 
 TEST_CASE("[Container]")
 {
@@ -89,6 +103,40 @@ TEST_CASE("[Container]")
             REQUIRE(container->get<tgui::Label>("w4") == widget4); // indirect child
         }
 
+        SECTION("direct and recursive")
+        {
+            REQUIRE(container->getDirect("w1") == widget1);
+            REQUIRE(container->getDirect("w4") == nullptr);
+            REQUIRE(container->getDirect<tgui::Panel>("w2") == widget2);
+            REQUIRE(container->getRecursive("w4") == widget4);
+            REQUIRE(container->getRecursive<tgui::Label>("w5") == widget5);
+            REQUIRE(container->getRecursive("w0") == nullptr);
+
+            // Names of widgets added to a child container are found from the parent
+            auto widget6 = tgui::Label::create();
+            widget2->add(widget6, "w6");
+            REQUIRE(container->getRecursive("w6") == widget6);
+
+            // Renaming a widget updates the names known to the parents
+            widget2->setWidgetName(widget6, "w7");
+            REQUIRE(container->getRecursive("w6") == nullptr);
+            REQUIRE(container->getRecursive("w7") == widget6);
+
+            // Removing a child container removes the names of all widgets inside it
+            container->remove(widget2);
+            REQUIRE(container->getRecursive("w4") == nullptr);
+            REQUIRE(container->getRecursive("w7") == nullptr);
+            REQUIRE(widget2->getRecursive("w7") == widget6);
+
+            container->add(widget2, "w2");
+            REQUIRE(container->getRecursive("w7") == widget6);
+
+            widget2->removeAllWidgets();
+            REQUIRE(container->getRecursive("w4") == nullptr);
+            REQUIRE(container->getRecursive("w7") == nullptr);
+            REQUIRE(container->getRecursive("w2") == widget2);
+        }
+
         SECTION("reusing name")
         {
             container->removeAllWidgets();
@@ -265,6 +313,86 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getInheritedOpacity() == 0.7f);
     }
 
+    SECTION("Spatial index")
+    {
+        auto group = tgui::Group::create({400, 400});
+        REQUIRE(!group->isSpatialIndexEnabled());
+        group->setSpatialIndexEnabled(true);
+        REQUIRE(group->isSpatialIndexEnabled());
+
+        std::vector<unsigned int> pressCount(100, 0);
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            auto widget = tgui::ClickableWidget::create({40, 40});
+            widget->setPosition((i % 10) * 40.f, (i / 10) * 40.f);
+            widget->connect("MousePressed", [&pressCount, i]{ pressCount[i]++; });
+            group->add(widget);
+        }
+
+        group->leftMousePressed({130, 250});
+        REQUIRE(pressCount[63] == 1);
+        REQUIRE(std::accumulate(pressCount.begin(), pressCount.end(), 0u) == 1);
+
+        // The widget in front receives the event
+        unsigned int frontPressCount = 0;
+        auto front = tgui::ClickableWidget::create({100, 100});
+        front->setPosition(100, 200);
+        front->connect("MousePressed", [&]{ frontPressCount++; });
+        group->add(front);
+
+        group->leftMousePressed({130, 250});
+        REQUIRE(frontPressCount == 1);
+        REQUIRE(pressCount[63] == 1);
+
+        // Moving a widget updates the index
+        front->setPosition(300, 300);
+        group->leftMousePressed({130, 250});
+        REQUIRE(frontPressCount == 1);
+        REQUIRE(pressCount[63] == 2);
+
+        group->leftMousePressed({330, 330});
+        REQUIRE(frontPressCount == 2);
+
+        // Invisible widgets are skipped
+        front->hide();
+        group->leftMousePressed({330, 330});
+        REQUIRE(frontPressCount == 2);
+        REQUIRE(pressCount[88] == 1);
+
+        // Widgets that are larger than their size are checked even when not in the grid cell
+        unsigned int radioButtonPressCount = 0;
+        auto radioButton = tgui::RadioButton::create();
+        radioButton->setSize(20, 20);
+        radioButton->setText("Radio button text");
+        radioButton->connect("MousePressed", [&]{ radioButtonPressCount++; });
+        group->add(radioButton);
+
+        group->leftMousePressed({radioButton->getFullSize().x - 1, 10});
+        REQUIRE(radioButtonPressCount == 1);
+
+        // Widgets derived from the widgets in the index may override mouseOnWidget, so they aren't placed in the index
+        unsigned int largeWidgetPressCount = 0;
+        auto largeWidget = std::make_shared<LargeClickableWidget>();
+        largeWidget->setPosition(200, 0);
+        largeWidget->setSize(20, 20);
+        largeWidget->connect("MousePressed", [&]{ largeWidgetPressCount++; });
+        group->add(largeWidget);
+
+        group->leftMousePressed({250, 50});
+        REQUIRE(largeWidgetPressCount == 1);
+        REQUIRE(pressCount[16] == 0);
+
+        // Removing widgets changes the indices of the widgets in front of it
+        group->remove(group->getWidgets()[0]);
+        group->leftMousePressed({130, 250});
+        REQUIRE(pressCount[63] == 3);
+
+        group->setSpatialIndexEnabled(false);
+        group->leftMousePressed({130, 250});
+        REQUIRE(pressCount[63] == 4);
+        REQUIRE(std::accumulate(pressCount.begin(), pressCount.end(), 0u) == 5);
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
@@ -0,0 +1,77 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/GlyphMetrics.hpp>
+#include <TGUI/Font.hpp>
+
+TEST_CASE("[GlyphMetrics]")
+{
+    tgui::Font font{"resources/DejaVuSans.ttf"};
+
+    REQUIRE(tgui::GlyphMetrics::get(nullptr, 20, false) == nullptr);
+
+    auto metrics = tgui::GlyphMetrics::get(font.getFont(), 20, false);
+    REQUIRE(metrics != nullptr);
+    REQUIRE(metrics == tgui::GlyphMetrics::get(font.getFont(), 20, false));
+    REQUIRE(metrics != tgui::GlyphMetrics::get(font.getFont(), 20, true));
+    REQUIRE(metrics != tgui::GlyphMetrics::get(font.getFont(), 24, false));
+
+    SECTION("Advance")
+    {
+        REQUIRE(metrics->getAdvance('A') == font.getGlyph('A', 20, false).advance);
+        REQUIRE(metrics->getAdvance('A') == font.getGlyph('A', 20, false).advance);
+        REQUIRE(metrics->getAdvance(0x3A9) == font.getGlyph(0x3A9, 20, false).advance);
+        REQUIRE(metrics->getAdvance('\t') == 4 * font.getGlyph(' ', 20, false).advance);
+        REQUIRE(tgui::GlyphMetrics::get(font.getFont(), 20, true)->getAdvance('m') == font.getGlyph('m', 20, true).advance);
+    }
+
+    SECTION("Kerning")
+    {
+        REQUIRE(metrics->getKerning('A', 'V') == font.getKerning('A', 'V', 20));
+        REQUIRE(metrics->getKerning('A', 'V') == font.getKerning('A', 'V', 20));
+        REQUIRE(metrics->getKerning(0, 'V') == 0);
+    }
+
+    SECTION("Character offsets")
+    {
+        std::vector<float> offsets;
+        metrics->getCharacterOffsets("AV a\nb", offsets);
+        REQUIRE(offsets.size() == 7);
+        REQUIRE(offsets[0] == 0);
+        REQUIRE(offsets[1] == metrics->getAdvance('A'));
+        REQUIRE(offsets[2] == offsets[1] + (metrics->getAdvance('V') + metrics->getKerning('A', 'V')));
+        for (std::size_t i = 1; i < 5; ++i)
+            REQUIRE(offsets[i] >= offsets[i-1]);
+
+        // The width starts again after a newline
+        REQUIRE(offsets[5] == 0);
+        REQUIRE(offsets[6] == metrics->getAdvance('b') + metrics->getKerning('\n', 'b'));
+
+        metrics->getCharacterOffsets("", offsets);
+        REQUIRE(offsets.size() == 1);
+        REQUIRE(offsets[0] == 0);
+    }
+}
@@ -0,0 +1,318 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/Widgets/Group.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    sf::Event createMouseMoveEvent(int x, int y)
+    {
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = x;
+        event.mouseMove.y = y;
+        return event;
+    }
+
+    sf::Event createMouseButtonEvent(sf::Event::EventType type, int x, int y)
+    {
+        sf::Event event;
+        event.type = type;
+        event.mouseButton.button = sf::Mouse::Left;
+        event.mouseButton.x = x;
+        event.mouseButton.y = y;
+        return event;
+    }
+}
+
+TEST_CASE("[Gui]")
+{
+    sf::RenderTexture target;
+    target.create(200, 200);
+    tgui::Gui gui{target};
+
+    SECTION("Event queue")
+    {
+        unsigned int mouseEnteredCount1 = 0;
+        auto widget1 = tgui::ClickableWidget::create({20, 20});
+        widget1->setPosition(10, 10);
+        widget1->connect("MouseEntered", [&]{ mouseEnteredCount1++; });
+        gui.add(widget1);
+
+        unsigned int mouseEnteredCount2 = 0;
+        unsigned int mousePressedCount2 = 0;
+        auto widget2 = tgui::ClickableWidget::create({20, 20});
+        widget2->setPosition(100, 100);
+        widget2->connect("MouseEntered", [&]{ mouseEnteredCount2++; });
+        widget2->connect("MousePressed", [&]{ mousePressedCount2++; });
+        gui.add(widget2);
+
+        REQUIRE(!gui.isEventQueueEnabled());
+        gui.setEventQueueEnabled(true);
+        REQUIRE(gui.isEventQueueEnabled());
+
+        // The mouse passes over the first widget, but only the last position is handled
+        REQUIRE(!gui.handleEvent(createMouseMoveEvent(5, 5)));
+        REQUIRE(!gui.handleEvent(createMouseMoveEvent(15, 15)));
+        REQUIRE(!gui.handleEvent(createMouseMoveEvent(60, 60)));
+        REQUIRE(!gui.handleEvent(createMouseMoveEvent(110, 110)));
+        REQUIRE(gui.getQueuedEventCount() == 1);
+        REQUIRE(gui.getCoalescedEventCount() == 3);
+        REQUIRE(mouseEnteredCount2 == 0);
+
+        gui.processEventQueue();
+        REQUIRE(gui.getQueuedEventCount() == 0);
+        REQUIRE(mouseEnteredCount1 == 0);
+        REQUIRE(mouseEnteredCount2 == 1);
+
+        // Moves aren't coalesced across other events or while the mouse is down
+        gui.handleEvent(createMouseMoveEvent(15, 15));
+        gui.handleEvent(createMouseButtonEvent(sf::Event::MouseButtonPressed, 15, 15));
+        gui.handleEvent(createMouseMoveEvent(110, 110));
+        gui.handleEvent(createMouseMoveEvent(15, 15));
+        gui.handleEvent(createMouseButtonEvent(sf::Event::MouseButtonReleased, 15, 15));
+        gui.handleEvent(createMouseMoveEvent(110, 110));
+        gui.handleEvent(createMouseMoveEvent(111, 111));
+        REQUIRE(gui.getQueuedEventCount() == 6);
+        REQUIRE(gui.getCoalescedEventCount() == 4);
+
+        // The mouse left and entered the first widget again while the button was down
+        gui.processEventQueue();
+        REQUIRE(mouseEnteredCount1 == 2);
+        REQUIRE(mouseEnteredCount2 == 3);
+        REQUIRE(mousePressedCount2 == 0);
+
+        // Disabling the queue handles the remaining events
+        gui.handleEvent(createMouseButtonEvent(sf::Event::MouseButtonPressed, 110, 110));
+        REQUIRE(gui.getQueuedEventCount() == 1);
+        gui.setEventQueueEnabled(false);
+        REQUIRE(gui.getQueuedEventCount() == 0);
+        REQUIRE(mousePressedCount2 == 1);
+
+        REQUIRE(gui.handleEvent(createMouseButtonEvent(sf::Event::MouseButtonReleased, 110, 110)));
+    }
+
+    SECTION("Partial redraw")
+    {
+        auto widget = tgui::ClickableWidget::create({40, 20});
+        widget->setPosition(10, 10);
+        gui.add(widget);
+
+        // Changes aren't tracked while partial redrawing is disabled
+        REQUIRE(!gui.isPartialRedrawEnabled());
+        REQUIRE(gui.getDirtyRegions().empty());
+
+        gui.setPartialRedrawEnabled(true);
+        REQUIRE(gui.isPartialRedrawEnabled());
+        REQUIRE(gui.getDirtyRegions().empty());
+
+        // Both the old and new area have to be drawn when a widget moves
+        widget->setPosition(20, 10);
+        REQUIRE(gui.getDirtyRegions().size() == 2);
+        REQUIRE(gui.getDirtyRegions()[0] == tgui::FloatRect(10, 10, 40, 20));
+        REQUIRE(gui.getDirtyRegions()[1] == tgui::FloatRect(20, 10, 40, 20));
+
+        gui.draw();
+        REQUIRE(gui.getDirtyRegions().empty());
+
+        // Areas of widgets inside containers are passed to the gui in its own coordinates
+        auto group = tgui::Group::create({100, 100});
+        group->setPosition(50, 60);
+        gui.add(group);
+        gui.draw();
+
+        auto child = tgui::ClickableWidget::create({10, 10});
+        child->setPosition(5, 5);
+        group->add(child);
+        REQUIRE(gui.getDirtyRegions().size() == 1);
+        REQUIRE(gui.getDirtyRegions()[0] == tgui::FloatRect(55, 65, 10, 10));
+
+        // The same area isn't stored twice
+        child->hide();
+        REQUIRE(gui.getDirtyRegions().size() == 1);
+
+        // Nothing changes on the screen when a widget inside a hidden container changes
+        group->hide();
+        gui.draw();
+        child->show();
+        REQUIRE(gui.getDirtyRegions().empty());
+
+        // Only the changed area is drawn again, but the result is the same as when drawing everything
+        auto panel = tgui::Panel::create({50, 50});
+        panel->getRenderer()->setBorders(0);
+        panel->getRenderer()->setBackgroundColor(sf::Color::Red);
+        gui.add(panel);
+
+        target.clear(sf::Color::Green);
+        gui.draw();
+        target.display();
+        REQUIRE(target.getTexture().copyToImage().getPixel(25, 25) == sf::Color::Red);
+        REQUIRE(target.getTexture().copyToImage().getPixel(150, 150) == sf::Color::Green);
+
+        panel->getRenderer()->setBackgroundColor(sf::Color::Blue);
+        REQUIRE(gui.getDirtyRegions().size() == 1);
+
+        target.clear(sf::Color::Green);
+        gui.draw();
+        target.display();
+        REQUIRE(target.getTexture().copyToImage().getPixel(25, 25) == sf::Color::Blue);
+        REQUIRE(target.getTexture().copyToImage().getPixel(150, 150) == sf::Color::Green);
+
+        // The list of areas doesn't keep growing when many widgets change before the gui is drawn again
+        for (unsigned int i = 0; i < 20; ++i)
+        {
+            auto smallWidget = tgui::ClickableWidget::create({5, 5});
+            smallWidget->setPosition(i * 10.f, 190);
+            gui.add(smallWidget);
+            REQUIRE(gui.getDirtyRegions().size() <= 8);
+        }
+
+        gui.setPartialRedrawEnabled(false);
+        REQUIRE(gui.getDirtyRegions().empty());
+    }
+
+    SECTION("Cached rendering")
+    {
+        auto group = tgui::Group::create({100, 100});
+        group->setPosition(50, 50);
+        gui.add(group);
+
+        auto panel = tgui::Panel::create({40, 40});
+        panel->setPosition(10, 10);
+        panel->getRenderer()->setBorders(0);
+        panel->getRenderer()->setBackgroundColor(sf::Color::Red);
+        group->add(panel);
+
+        REQUIRE(!group->getCachedRendering());
+        group->setCachedRendering(true);
+        REQUIRE(group->getCachedRendering());
+        REQUIRE(group->getCachedRenderingUpdateCount() == 0);
+
+        // The children are only drawn on the texture when something changed
+        target.clear(sf::Color::Green);
+        gui.draw();
+        target.display();
+        REQUIRE(group->getCachedRenderingUpdateCount() == 1);
+        REQUIRE(target.getTexture().copyToImage().getPixel(70, 70) == sf::Color::Red);
+        REQUIRE(target.getTexture().copyToImage().getPixel(55, 55) == sf::Color::Green);
+
+        target.clear(sf::Color::Green);
+        gui.draw();
+        target.display();
+        REQUIRE(group->getCachedRenderingUpdateCount() == 1);
+        REQUIRE(target.getTexture().copyToImage().getPixel(70, 70) == sf::Color::Red);
+
+        // Moving the container itself doesn't require the texture to be updated
+        group->setPosition(60, 60);
+        gui.draw();
+        REQUIRE(group->getCachedRenderingUpdateCount() == 1);
+
+        // Changes to child widgets, even nested ones, are noticed by the container
+        panel->getRenderer()->setBackgroundColor(sf::Color::Blue);
+        target.clear(sf::Color::Green);
+        gui.draw();
+        target.display();
+        REQUIRE(group->getCachedRenderingUpdateCount() == 2);
+        REQUIRE(target.getTexture().copyToImage().getPixel(80, 80) == sf::Color::Blue);
+
+        auto child = tgui::ClickableWidget::create({10, 10});
+        panel->add(child);
+        gui.draw();
+        REQUIRE(group->getCachedRenderingUpdateCount() == 3);
+
+        group->remove(panel);
+        target.clear(sf::Color::Green);
+        gui.draw();
+        target.display();
+        REQUIRE(group->getCachedRenderingUpdateCount() == 4);
+        REQUIRE(target.getTexture().copyToImage().getPixel(80, 80) == sf::Color::Green);
+
+        group->setCachedRendering(false);
+        REQUIRE(!group->getCachedRendering());
+        REQUIRE(group->getCachedRenderingUpdateCount() == 0);
+    }
+
+    SECTION("Async texture loading")
+    {
+        tgui::TextureManager::setAsyncLoadingEnabled(true);
+
+        tgui::Theme theme{"resources/Black.txt"};
+        auto scrollbar = tgui::Scrollbar::create();
+        scrollbar->setRenderer(theme.getRenderer("Scrollbar"));
+        scrollbar->setSize(20, 180);
+        scrollbar->setMaximum(20);
+        scrollbar->setLowValue(5);
+        gui.add(scrollbar);
+
+        auto picture = tgui::Picture::create("resources/image.png");
+        picture->setPosition(150, 0);
+        gui.add(picture);
+
+        REQUIRE(picture->getRenderer()->getTexture().getData()->loading);
+        REQUIRE(picture->getSize() == sf::Vector2f(0, 0));
+
+        unsigned int loadedCount = 0;
+        gui.onTexturesLoaded.connect([&]{ ++loadedCount; });
+        while (tgui::TextureManager::getLoadingImageCount() > 0)
+        {
+            gui.draw();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        gui.draw();
+        REQUIRE(loadedCount == 1);
+
+        // The widgets recalculated the sizes that depend on the images once they were loaded
+        REQUIRE(picture->getSize() == picture->getRenderer()->getTexture().getImageSize());
+        REQUIRE(picture->getSize() != sf::Vector2f(0, 0));
+
+        // The scrollbar looks the same as a scrollbar that was created with images that were already loaded
+        auto scrollbarCopy = tgui::Scrollbar::copy(scrollbar);
+        scrollbarCopy->setPosition(100, 0);
+        gui.add(scrollbarCopy);
+
+        target.clear(sf::Color::Green);
+        gui.draw();
+        target.display();
+        const sf::Image image = target.getTexture().copyToImage();
+        for (unsigned int y = 0; y < 180; ++y)
+        {
+            for (unsigned int x = 0; x < 20; ++x)
+                REQUIRE(image.getPixel(x, y) == image.getPixel(100 + x, y));
+        }
+
+        tgui::TextureManager::setAsyncLoadingEnabled(false);
+    }
+}
@@ -0,0 +1,124 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+#include <TGUI/LayoutSolver.hpp>
+#include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+using namespace tgui::bind_functions;
+
+TEST_CASE("[LayoutSolver]")
+{
+    auto panel = tgui::Panel::create({400, 300});
+
+    auto widget1 = tgui::ClickableWidget::create();
+    auto widget2 = tgui::ClickableWidget::create();
+    auto widget3 = tgui::ClickableWidget::create();
+
+    REQUIRE(!tgui::LayoutSolver::isDeferredUpdatesEnabled());
+
+    SECTION("Immediate updates")
+    {
+        widget1->setSize(bindSize(panel) / 2);
+        widget2->setSize(bindWidth(panel) / 4, 50);
+        widget3->setSize(bindWidth(widget1) + bindWidth(widget2), bindHeight(widget1));
+        REQUIRE(widget3->getSize() == sf::Vector2f(300, 150));
+
+        panel->setSize(800, 600);
+        REQUIRE(tgui::LayoutSolver::getPendingCount() == 0);
+        REQUIRE(widget3->getSize() == sf::Vector2f(600, 300));
+    }
+
+    SECTION("Deferred updates")
+    {
+        tgui::LayoutSolver::setDeferredUpdatesEnabled(true);
+        REQUIRE(tgui::LayoutSolver::isDeferredUpdatesEnabled());
+
+        widget1->setSize(bindSize(panel) / 2);
+        widget2->setSize(bindWidth(panel) / 4, 50);
+        widget3->setSize(bindWidth(widget1) + bindWidth(widget2), bindHeight(widget1));
+        widget3->setPosition(bindRight(widget1), bindBottom(widget2));
+        REQUIRE(widget3->getSize() == sf::Vector2f(300, 150));
+        REQUIRE(widget3->getPosition() == sf::Vector2f(200, 50));
+        tgui::LayoutSolver::flush();
+
+        panel->setSize(800, 600);
+        REQUIRE(tgui::LayoutSolver::getPendingCount() == 2);
+        REQUIRE(widget3->getSize() == sf::Vector2f(300, 150));
+
+        // Widget 3 depends on both other widgets but is only updated once
+        tgui::LayoutSolver::flush();
+        REQUIRE(tgui::LayoutSolver::getPendingCount() == 0);
+        REQUIRE(tgui::LayoutSolver::getUpdateCount() == 4);
+        REQUIRE(widget1->getSize() == sf::Vector2f(400, 300));
+        REQUIRE(widget2->getSize() == sf::Vector2f(200, 50));
+        REQUIRE(widget3->getSize() == sf::Vector2f(600, 300));
+        REQUIRE(widget3->getPosition() == sf::Vector2f(400, 50));
+
+        tgui::LayoutSolver::flush();
+        REQUIRE(tgui::LayoutSolver::getUpdateCount() == 0);
+
+        SECTION("Disabling deferred updates flushes pending updates")
+        {
+            panel->setSize(200, 100);
+            REQUIRE(tgui::LayoutSolver::getPendingCount() == 2);
+
+            tgui::LayoutSolver::setDeferredUpdatesEnabled(false);
+            REQUIRE(tgui::LayoutSolver::getPendingCount() == 0);
+            REQUIRE(widget3->getSize() == sf::Vector2f(150, 50));
+        }
+
+        SECTION("Destroyed widgets are forgotten")
+        {
+            panel->setSize(200, 100);
+            widget1 = nullptr;
+            widget2 = nullptr;
+            REQUIRE(tgui::LayoutSolver::getPendingCount() == 1);
+
+            tgui::LayoutSolver::flush();
+            REQUIRE(tgui::LayoutSolver::getPendingCount() == 0);
+        }
+
+        tgui::LayoutSolver::setDeferredUpdatesEnabled(false);
+    }
+
+    SECTION("Cycle")
+    {
+        tgui::LayoutSolver::setDeferredUpdatesEnabled(true);
+
+        widget1->setSize(bindWidth(widget2), 50);
+        widget2->setSize(bindWidth(widget1) + 10, 50);
+
+        std::streambuf *oldbuf = sf::err().rdbuf(0);
+        tgui::LayoutSolver::flush();
+        sf::err().rdbuf(oldbuf);
+
+        REQUIRE(tgui::LayoutSolver::getPendingCount() == 0);
+
+        tgui::LayoutSolver::setDeferredUpdatesEnabled(false);
+    }
+}
@@ -0,0 +1,65 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+#include <TGUI/PropertyId.hpp>
+#include <TGUI/Renderers/ButtonRenderer.hpp>
+
+TEST_CASE("[PropertyId]")
+{
+    SECTION("Predefined properties")
+    {
+        REQUIRE(tgui::PropertyId{}.getName() == "");
+        REQUIRE(tgui::PropertyId{tgui::Property::TextColor}.getName() == "textcolor");
+        REQUIRE(tgui::PropertyId{tgui::Property::TextureTitleBar}.getName() == "texturetitlebar");
+
+        REQUIRE(tgui::PropertyId{"textcolor"}.getId() == tgui::Property::TextColor);
+        REQUIRE(tgui::PropertyId{std::string{"opacity"}} == tgui::Property::Opacity);
+    }
+
+    SECTION("Other names")
+    {
+        const tgui::PropertyId id{"SomeCustomProperty"};
+        REQUIRE(id.getId() >= tgui::Property::Count);
+        REQUIRE(id.getName() == "SomeCustomProperty");
+        REQUIRE(tgui::PropertyId{"SomeCustomProperty"} == id);
+
+        // Names are case-sensitive
+        REQUIRE(tgui::PropertyId{"somecustomproperty"} != id);
+    }
+
+    SECTION("Renderer")
+    {
+        tgui::ButtonRenderer renderer;
+        renderer.setProperty("TextColor", sf::Color::Red);
+        REQUIRE(renderer.getPropertyValuePairs().size() == 1);
+        REQUIRE(renderer.getPropertyValuePairs().begin()->first == tgui::Property::TextColor);
+
+        renderer.setProperty(tgui::Property::TextColor, sf::Color::Green);
+        REQUIRE(renderer.getTextColor() == sf::Color::Green);
+        REQUIRE(renderer.getProperty("textcolor").getColor() == sf::Color::Green);
+    }
+}
@@ -125,6 +125,24 @@ TEST_CASE("[Signal]")
         REQUIRE(widget2->connect("Pressed", std::function<void(std::string)>([](std::string){})) == ++id);
     }
 
+    SECTION("connect to signals of multiple widgets")
+    {
+        // The signal names are looked up in a map that is shared by all widgets of the same type
+        unsigned int count1 = 0;
+        unsigned int count2 = 0;
+        tgui::Widget::Ptr widget2 = tgui::ClickableWidget::create();
+        widget->connect("positionchanged", [&]{ count1++; });
+        widget2->connect("PositionChanged", [&]{ count2++; });
+
+        widget2->setPosition(10, 10);
+        REQUIRE(count1 == 0);
+        REQUIRE(count2 == 1);
+
+        widget->setPosition(10, 10);
+        REQUIRE(count1 == 1);
+        REQUIRE(count2 == 1);
+    }
+
     SECTION("disconnect")
     {
         unsigned int i = 0;
@@ -170,5 +188,88 @@ TEST_CASE("[Signal]")
         widget->setPosition(60, 60);
         widget->setSize(400, 100);
         REQUIRE(i == 5);
+
+        REQUIRE(!widget->onPositionChange.disconnect(id));
+        id = widget->onPositionChange.connect([](){});
+        REQUIRE(widget->onPositionChange.disconnect(id));
+        REQUIRE(!widget->onPositionChange.disconnect(id));
+    }
+
+    SECTION("connect and disconnect while emitting")
+    {
+        unsigned int count1 = 0;
+        unsigned int count2 = 0;
+        unsigned int count3 = 0;
+        unsigned int id2 = 0;
+        unsigned int id1 = widget->onPositionChange.connect([&]{
+                count1++;
+                widget->onPositionChange.disconnect(id1);
+                widget->onPositionChange.disconnect(id2);
+                widget->onPositionChange.connect([&]{ count3++; });
+            });
+        id2 = widget->onPositionChange.connect([&]{ count2++; });
+
+        // The second handler is disconnected before it gets called, the new handler is only called on the next emit
+        widget->setPosition(10, 10);
+        REQUIRE(count1 == 1);
+        REQUIRE(count2 == 0);
+        REQUIRE(count3 == 0);
+
+        widget->setPosition(20, 20);
+        REQUIRE(count1 == 1);
+        REQUIRE(count2 == 0);
+        REQUIRE(count3 == 1);
+
+        // The signal may be destroyed by a handler, the remaining handlers still get called
+        auto signal = std::make_unique<tgui::Signal>("Destroyed");
+        signal->connect([&]{ count1++; signal = nullptr; });
+        signal->connect([&]{ count2++; });
+        signal->emit(widget.get());
+        REQUIRE(signal == nullptr);
+        REQUIRE(count1 == 2);
+        REQUIRE(count2 == 1);
+    }
+
+    SECTION("emit from within a signal handler")
+    {
+        sf::Vector2f size;
+        sf::Vector2f position;
+        widget->connect("SizeChanged", [&](sf::Vector2f value){ size = value; });
+        widget->connect("PositionChanged", [&]{ widget->setSize(300, 200); });
+        widget->connect("PositionChanged", [&](sf::Vector2f value){ position = value; });
+
+        // The parameters of the outer emit must not be overwritten by the emit in the handler
+        widget->setPosition(40, 30);
+        REQUIRE(size == sf::Vector2f(300, 200));
+        REQUIRE(position == sf::Vector2f(40, 30));
+    }
+}
+
+TEST_CASE("[Signal] Emit benchmark", "[.benchmark]")
+{
+    tgui::Widget::Ptr widget = tgui::ClickableWidget::create();
+    const tgui::Widget* sender = widget.get();
+
+    unsigned int count = 0;
+    for (unsigned int i = 0; i < 8; ++i)
+        widget->onMouseEnter.connect([&]{ count++; });
+
+    // Emitting used to copy a map with the handlers before calling them
+    std::map<unsigned int, std::function<void()>> handlerMap;
+    for (unsigned int i = 0; i < 8; ++i)
+        handlerMap[i] = [&]{ count++; };
+
+    BENCHMARK("Emit while copying the handlers")
+    {
+        auto handlers = handlerMap;
+        for (auto& handler : handlers)
+            handler.second();
     }
+
+    BENCHMARK("Emit")
+    {
+        widget->onMouseEnter.emit(sender);
+    }
+
+    REQUIRE(count > 0);
 }
@@ -12,6 +12,28 @@ void genericCallback(unsigned int& count)
     count++;
 }
 
+sf::Image drawToImage(sf::RenderTexture& target, tgui::Gui& gui)
+{
+    target.clear({25, 130, 10});
+    gui.draw();
+    target.display();
+    return target.getTexture().copyToImage();
+}
+
+bool compareImageAreas(const sf::Image& leftImage, sf::Vector2u leftPosition, const sf::Image& rightImage, sf::Vector2u rightPosition, sf::Vector2u size)
+{
+    for (unsigned int y = 0; y < size.y; ++y)
+    {
+        for (unsigned int x = 0; x < size.x; ++x)
+        {
+            if (leftImage.getPixel(leftPosition.x + x, leftPosition.y + y) != rightImage.getPixel(rightPosition.x + x, rightPosition.y + y))
+                return false;
+        }
+    }
+
+    return true;
+}
+
 void testWidgetSignals(tgui::Widget::Ptr widget)
 {
     // TODO: Test other signals than MouseEntered and MouseLeft
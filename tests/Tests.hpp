@@ -69,6 +69,12 @@ static const sf::Time DOUBLE_CLICK_TIMEOUT = sf::milliseconds(500);
 
 bool compareFiles(const std::string& leftFileName, const std::string& rightFileName);
 
+// Draws the gui that was created with TEST_DRAW_INIT and returns the contents of the render target
+sf::Image drawToImage(sf::RenderTexture& target, tgui::Gui& gui);
+
+// Checks whether an area in the first image contains the same pixels as an area of the same size in the second image
+bool compareImageAreas(const sf::Image& leftImage, sf::Vector2u leftPosition, const sf::Image& rightImage, sf::Vector2u rightPosition, sf::Vector2u size);
+
 void mouseCallback(unsigned int& count, sf::Vector2f pos);
 void genericCallback(unsigned int& count);
 
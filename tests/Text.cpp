@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Text.hpp>
+#include <algorithm>
 
 TEST_CASE("[Text]")
 {
@@ -135,4 +136,56 @@ TEST_CASE("[Text]")
             REQUIRE(text.getSize().y == text3.getSize().y);
         }
     }
+
+    SECTION("Word wrap")
+    {
+        tgui::Font font{"resources/DejaVuSans.ttf"};
+        text.setFont(font);
+        text.setCharacterSize(20);
+        text.setString("Hello world");
+        const float maxWidth = text.getSize().x;
+
+        REQUIRE(tgui::Text::findLineBreaks(maxWidth, "Hello world Hello world", font, 20, false) == std::vector<std::size_t>{12});
+        REQUIRE(tgui::Text::wordWrap(maxWidth, "Hello world Hello world", font, 20, false) == "Hello world \nHello world");
+        REQUIRE(tgui::Text::wordWrap(maxWidth, "Hello world Hello world", font, 20, false, false) == "Hello world\n Hello world");
+
+        REQUIRE(tgui::Text::findLineBreaks(0, "a\nb\n", font, 20, false) == std::vector<std::size_t>{2, 4});
+        REQUIRE(tgui::Text::wordWrap(0, "a\nb\n", font, 20, false) == "a\nb\n");
+
+        // Lines at the end of a long text are wrapped at the same place as the first line
+        std::string longText;
+        for (unsigned int i = 0; i < 50000; ++i)
+            longText += "Hello world Hello world\n";
+        const std::vector<std::size_t> lineBreaks = tgui::Text::findLineBreaks(maxWidth, longText, font, 20, false);
+        REQUIRE(lineBreaks.size() == 100000);
+        REQUIRE(lineBreaks[lineBreaks.size() - 2] == longText.size() - 24 + 12);
+        REQUIRE(lineBreaks.back() == longText.size());
+
+        REQUIRE(tgui::Text::findLineBreaks(maxWidth, "", font, 20, false).empty());
+        REQUIRE(tgui::Text::findLineBreaks(maxWidth, "Hello", nullptr, 20, false).empty());
+    }
+}
+
+TEST_CASE("[Text] Word wrap benchmark", "[.benchmark]")
+{
+    tgui::Font font{"resources/DejaVuSans.ttf"};
+
+    sf::String longText;
+    for (unsigned int i = 0; i < 20000; ++i)
+        longText += (i % 50 == 49) ? "paragraph\n" : "word ";
+
+    std::size_t lineCount = 0;
+    BENCHMARK("Wrap the text and search the newlines")
+    {
+        const sf::String wrappedText = tgui::Text::wordWrap(300, longText, font, 16, false);
+        lineCount = std::count(wrappedText.begin(), wrappedText.end(), '\n') + 1;
+    }
+
+    std::size_t lineBreakCount = 0;
+    BENCHMARK("Find line breaks")
+    {
+        lineBreakCount = tgui::Text::findLineBreaks(300, longText, font, 16, false).size();
+    }
+
+    REQUIRE(lineBreakCount + 1 == lineCount);
 }
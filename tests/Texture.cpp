@@ -25,8 +25,12 @@
 #include "Tests.hpp"
 #include <TGUI/Exception.hpp>
 #include <TGUI/Texture.hpp>
+#include <TGUI/Sprite.hpp>
 #include <TGUI/TextureManager.hpp>
 #include <SFML/System/Err.hpp>
+#include <algorithm>
+#include <chrono>
+#include <thread>
 
 TEST_CASE("[Texture]")
 {
@@ -158,6 +162,22 @@ TEST_CASE("[Texture]")
         REQUIRE(destructCount == 3);
     }
 
+    SECTION("Copy and destruct many times")
+    {
+        tgui::Texture texture{"resources/image.png", {0, 0, 20, 20}};
+        {
+            std::vector<tgui::Texture> copies(1000, texture);
+            REQUIRE(copies.back().getData() == texture.getData());
+        }
+
+        tgui::Texture otherTexture{"resources/image.png", {0, 0, 20, 20}};
+        REQUIRE(otherTexture.getData() == texture.getData());
+
+        auto data = std::make_shared<tgui::TextureData>();
+        REQUIRE_THROWS_AS(tgui::TextureManager::copyTexture(data), tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(data), tgui::Exception);
+    }
+
     SECTION("MiddleRect")
     {
         tgui::Texture texture;
@@ -179,6 +199,135 @@ TEST_CASE("[Texture]")
         REQUIRE(!texture.isSmooth());
     }
 
+    SECTION("Atlas")
+    {
+        REQUIRE(!tgui::TextureManager::isAtlasEnabled());
+        tgui::TextureManager::setAtlasEnabled(true);
+        REQUIRE(tgui::TextureManager::isAtlasEnabled());
+        {
+            tgui::Texture texture1{"resources/image.png", {1, 2, 40, 30}};
+            tgui::Texture texture2{"resources/image.png", {3, 4, 20, 20}};
+            REQUIRE(texture1.getData()->atlasTexture != nullptr);
+            REQUIRE(texture1.getData()->atlasTexture == texture2.getData()->atlasTexture);
+            REQUIRE(texture1.getData()->atlasRect.width == 40);
+            REQUIRE(texture1.getData()->atlasRect.height == 30);
+            REQUIRE(!texture1.getData()->atlasRect.intersects(texture2.getData()->atlasRect));
+            REQUIRE(texture1.getImageSize() == sf::Vector2f(40, 30));
+            REQUIRE(texture1.getMiddleRect() == sf::IntRect(0, 0, 40, 30));
+
+            // A smooth texture gets its own texture instead of making the whole atlas smooth
+            tgui::Sprite sprite;
+            sprite.setTexture(texture2);
+            texture2.setSmooth(true);
+            REQUIRE(texture2.isSmooth());
+            REQUIRE(!texture1.isSmooth());
+            REQUIRE(texture2.getData()->atlasTexture == nullptr);
+            REQUIRE(texture2.getData()->texture.getSize() == sf::Vector2u(20, 20));
+            REQUIRE(texture2.getImageSize() == sf::Vector2f(20, 20));
+
+            // A sprite that was created while the image was still in the atlas has to look the same as a new sprite
+            sf::RenderTexture target1;
+            sf::RenderTexture target2;
+            target1.create(20, 20);
+            target2.create(20, 20);
+            target1.clear();
+            target2.clear();
+            sprite.draw(target1, {});
+            tgui::Sprite newSprite;
+            newSprite.setTexture(texture2);
+            newSprite.draw(target2, {});
+            target1.display();
+            target2.display();
+            const sf::Image image1 = target1.getTexture().copyToImage();
+            const sf::Image image2 = target2.getTexture().copyToImage();
+            REQUIRE(std::equal(image1.getPixelsPtr(), image1.getPixelsPtr() + (20 * 20 * 4), image2.getPixelsPtr()));
+        }
+        tgui::TextureManager::setAtlasEnabled(false);
+    }
+
+    SECTION("Image is shared between parts")
+    {
+        unsigned int count = 0;
+        auto oldImageLoader = tgui::Texture::getImageLoader();
+        tgui::Texture::setImageLoader([&](const sf::String& filename){ count++; return oldImageLoader(filename); });
+
+        tgui::Texture texture1{"resources/image.png", {5, 6, 20, 30}};
+        tgui::Texture texture2{"resources/image.png", {6, 7, 20, 30}};
+        REQUIRE(count == 1);
+        REQUIRE(texture1.getData() != texture2.getData());
+        REQUIRE(texture1.getData()->image == texture2.getData()->image);
+
+        tgui::Texture::setImageLoader(oldImageLoader);
+    }
+
+    SECTION("AlphaMask")
+    {
+        REQUIRE(!tgui::TextureManager::isAlphaMaskEnabled());
+        tgui::TextureManager::setAlphaMaskEnabled(true);
+        REQUIRE(tgui::TextureManager::isAlphaMaskEnabled());
+        {
+            tgui::Texture texture{"resources/TransparentParts.png", {1, 1, 48, 48}};
+            REQUIRE(texture.getData()->image == nullptr);
+            REQUIRE(texture.getData()->alphaMask != nullptr);
+            REQUIRE(texture.getImageSize() == sf::Vector2f(48, 48));
+
+            tgui::TextureManager::setAlphaMaskEnabled(false);
+            tgui::Texture textureWithImage{"resources/TransparentParts.png", {1, 1, 48, 48}};
+            REQUIRE(textureWithImage.getData() == texture.getData());
+
+            tgui::Texture otherPart{"resources/TransparentParts.png"};
+            REQUIRE(otherPart.getData()->image != nullptr);
+            for (unsigned int x = 0; x < 48; x += 3)
+            {
+                for (unsigned int y = 0; y < 48; y += 3)
+                    REQUIRE(texture.isTransparentPixel({x, y}) == (otherPart.getData()->image->getPixel(x + 1, y + 1).a == 0));
+            }
+        }
+        tgui::TextureManager::setAlphaMaskEnabled(false);
+    }
+
+    SECTION("Async loading")
+    {
+        REQUIRE(!tgui::TextureManager::isAsyncLoadingEnabled());
+        tgui::TextureManager::setAsyncLoadingEnabled(true);
+        REQUIRE(tgui::TextureManager::isAsyncLoadingEnabled());
+        {
+            tgui::Texture texture1{"resources/image.png", {0, 0, 40, 30}};
+            tgui::Texture texture2{"resources/image.png", {10, 10, 40, 30}};
+            REQUIRE(texture1.getData()->loading);
+            REQUIRE(texture2.getData()->loading);
+            REQUIRE(texture1.getImageSize() == sf::Vector2f(0, 0));
+            REQUIRE(tgui::TextureManager::getLoadingImageCount() == 1);
+
+            tgui::Texture textureCopy = texture1;
+            while (tgui::TextureManager::getLoadingImageCount() > 0)
+            {
+                tgui::TextureManager::processLoadedImages(sf::milliseconds(10));
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            REQUIRE(!texture1.getData()->loading);
+            REQUIRE(texture1.getData()->image == texture2.getData()->image);
+            REQUIRE(texture1.getImageSize() == sf::Vector2f(40, 30));
+            REQUIRE(texture1.getMiddleRect() == sf::IntRect(0, 0, 40, 30));
+            REQUIRE(textureCopy.getImageSize() == sf::Vector2f(40, 30));
+            REQUIRE(texture2.getImageSize() == sf::Vector2f(40, 30));
+
+            std::streambuf *oldbuf = sf::err().rdbuf(0);
+            tgui::Texture missingTexture{"NonExistent.png"};
+            while (tgui::TextureManager::getLoadingImageCount() > 0)
+            {
+                tgui::TextureManager::processLoadedImages(sf::milliseconds(10));
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            sf::err().rdbuf(oldbuf);
+
+            REQUIRE(!missingTexture.getData()->loading);
+            REQUIRE(missingTexture.getImageSize() == sf::Vector2f(0, 0));
+        }
+        tgui::TextureManager::setAsyncLoadingEnabled(false);
+    }
+
     SECTION("Shader")
     {
         tgui::Texture texture{"resources/image.png"};
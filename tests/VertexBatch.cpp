@@ -0,0 +1,194 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/VertexBatch.hpp>
+#include <TGUI/Clipping.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Canvas.hpp>
+#include <TGUI/Widgets/ChatBox.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+
+namespace
+{
+    // Custom widget that draws directly on the render target without knowing about batching
+    class CustomPanel : public tgui::Panel
+    {
+    public:
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+        {
+            sf::RectangleShape shape{getSize()};
+            shape.setPosition(getPosition());
+            shape.setFillColor(sf::Color::Blue);
+            target.draw(shape, states);
+        }
+
+        tgui::Widget::Ptr clone() const override
+        {
+            return std::make_shared<CustomPanel>(*this);
+        }
+    };
+}
+
+TEST_CASE("[VertexBatch]")
+{
+    SECTION("Draw calls")
+    {
+        sf::RenderTexture target;
+        target.create(100, 100);
+
+        sf::RectangleShape shape{{10, 10}};
+        shape.setFillColor(sf::Color::Red);
+
+        tgui::VertexBatch::begin(target);
+        REQUIRE(tgui::VertexBatch::isActive(target));
+
+        tgui::VertexBatch::draw(target, shape, sf::RenderStates::Default);
+        shape.setPosition(20, 20);
+        tgui::VertexBatch::draw(target, shape, sf::RenderStates::Default);
+        REQUIRE(tgui::VertexBatch::getDrawCallCount() == 0);
+
+        tgui::VertexBatch::pause();
+        REQUIRE(!tgui::VertexBatch::isActive(target));
+        REQUIRE(tgui::VertexBatch::getDrawCallCount() == 1);
+        tgui::VertexBatch::resume();
+        REQUIRE(tgui::VertexBatch::isActive(target));
+
+        tgui::VertexBatch::draw(target, shape, sf::RenderStates::Default);
+        tgui::VertexBatch::end();
+        REQUIRE(!tgui::VertexBatch::isActive(target));
+        REQUIRE(tgui::VertexBatch::getDrawCallCount() == 2);
+    }
+
+    SECTION("Clipping")
+    {
+        sf::RenderTexture target;
+        target.create(100, 100);
+
+        sf::RectangleShape shape{{10, 10}};
+        shape.setFillColor(sf::Color::Red);
+
+        tgui::VertexBatch::begin(target);
+        {
+            tgui::Clipping clipping{target, sf::RenderStates::Default, {0, 0}, {15, 15}};
+
+            // Shapes outside the clipping area are dropped and the ones that are partially visible are cut on the CPU
+            shape.setPosition(20, 20);
+            tgui::VertexBatch::draw(target, shape, sf::RenderStates::Default);
+            shape.setPosition(10, 10);
+            tgui::VertexBatch::draw(target, shape, sf::RenderStates::Default);
+            REQUIRE(tgui::VertexBatch::isActive(target));
+        }
+
+        shape.setPosition(50, 50);
+        tgui::VertexBatch::draw(target, shape, sf::RenderStates::Default);
+        tgui::VertexBatch::end();
+
+        // The clipping didn't interrupt the batch
+        REQUIRE(tgui::VertexBatch::getDrawCallCount() == 1);
+    }
+
+    SECTION("Gui")
+    {
+        tgui::Gui gui;
+        REQUIRE(!gui.isBatchedRenderingEnabled());
+        gui.setBatchedRenderingEnabled(true);
+        REQUIRE(gui.isBatchedRenderingEnabled());
+        gui.setBatchedRenderingEnabled(false);
+        REQUIRE(!gui.isBatchedRenderingEnabled());
+    }
+
+    SECTION("Same result as unbatched rendering")
+    {
+        auto panel = tgui::Panel::create({80, 80});
+        panel->setPosition({10, 10});
+        panel->getRenderer()->setBackgroundColor(sf::Color::Yellow);
+        panel->getRenderer()->setBorders({2});
+
+        auto button = tgui::Button::create("Button");
+        button->setPosition({5, 5});
+        button->setSize({70, 25});
+        panel->add(button);
+
+        auto canvas = tgui::Canvas::create({20, 20});
+        canvas->setPosition({5, 35});
+        canvas->clear(sf::Color::Blue);
+        canvas->display();
+        panel->add(canvas);
+
+        auto chatBox = tgui::ChatBox::create();
+        chatBox->setPosition({30, 35});
+        chatBox->setSize({45, 40});
+        chatBox->setTextSize(12);
+        for (unsigned int i = 0; i < 6; ++i)
+            chatBox->addLine("Line that is too long to fit");
+        panel->add(chatBox);
+
+        auto label = tgui::Label::create("Label");
+        label->setPosition({10, 40});
+        label->getRenderer()->setTextStyle(sf::Text::Underlined);
+        panel->add(label);
+
+        TEST_DRAW_INIT(100, 100, panel)
+
+        target.clear({25, 130, 10});
+        gui.draw();
+        target.display();
+        target.getTexture().copyToImage().saveToFile("VertexBatch_Unbatched.png");
+
+        // The canvas interrupts the batch, so the button and label are drawn in separate batches
+        gui.setBatchedRenderingEnabled(true);
+        target.clear({25, 130, 10});
+        gui.draw();
+        target.display();
+        target.getTexture().copyToImage().saveToFile("VertexBatch_Batched.png");
+
+        REQUIRE(compareFiles("VertexBatch_Batched.png", "VertexBatch_Unbatched.png"));
+    }
+
+    SECTION("Derived widgets are not batched unless they opt in")
+    {
+        auto panel = tgui::Panel::create({50, 50});
+        panel->getRenderer()->setBorders(0);
+        panel->getRenderer()->setBackgroundColor(sf::Color::Red);
+
+        auto customPanel = std::make_shared<CustomPanel>();
+        customPanel->setPosition({25, 25});
+        customPanel->setSize({50, 50});
+
+        TEST_DRAW_INIT(100, 100, panel)
+        gui.add(customPanel);
+        gui.setBatchedRenderingEnabled(true);
+
+        // The red panel has to be drawn before the custom widget draws on top of it
+        target.clear(sf::Color::Green);
+        gui.draw();
+        target.display();
+        REQUIRE(target.getTexture().copyToImage().getPixel(10, 10) == sf::Color::Red);
+        REQUIRE(target.getTexture().copyToImage().getPixel(40, 40) == sf::Color::Blue);
+    }
+}
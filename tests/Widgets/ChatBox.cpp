@@ -62,6 +62,15 @@ TEST_CASE("[ChatBox]")
 
         REQUIRE(chatBox->getLineColor(0) == sf::Color::Black);
         REQUIRE(chatBox->getLineColor(1) == sf::Color::Green);
+
+        chatBox->addLines({"Line 3", "Line 4"});
+        chatBox->addLines({"Line 5"}, sf::Color::Red);
+        REQUIRE(chatBox->getLineAmount() == 5);
+        REQUIRE(chatBox->getLine(2) == "Line 3");
+        REQUIRE(chatBox->getLine(3) == "Line 4");
+        REQUIRE(chatBox->getLine(4) == "Line 5");
+        REQUIRE(chatBox->getLineColor(3) == sf::Color::Black);
+        REQUIRE(chatBox->getLineColor(4) == sf::Color::Red);
     }
 
     SECTION("Removing lines")
@@ -103,6 +112,11 @@ TEST_CASE("[ChatBox]")
             chatBox->addLine("Line 4");
             REQUIRE(chatBox->getLine(0) == "Line 3");
             REQUIRE(chatBox->getLine(1) == "Line 4");
+
+            chatBox->addLines({"Line 5", "Line 6", "Line 7"});
+            REQUIRE(chatBox->getLineAmount() == 2);
+            REQUIRE(chatBox->getLine(0) == "Line 6");
+            REQUIRE(chatBox->getLine(1) == "Line 7");
         }
 
         SECTION("Oldest at the bottom")
@@ -123,7 +137,90 @@ TEST_CASE("[ChatBox]")
             chatBox->addLine("Line 4");
             REQUIRE(chatBox->getLine(0) == "Line 4");
             REQUIRE(chatBox->getLine(1) == "Line 3");
+
+            chatBox->addLines({"Line 5", "Line 6", "Line 7"});
+            REQUIRE(chatBox->getLineAmount() == 2);
+            REQUIRE(chatBox->getLine(0) == "Line 7");
+            REQUIRE(chatBox->getLine(1) == "Line 6");
         }
+
+        SECTION("Streaming many lines")
+        {
+            // With large lines, the positions would pass the range in which a float can store all integers if they
+            // weren't moved back while the oldest lines are being removed
+            chatBox->getRenderer()->setBorders(0);
+            chatBox->getRenderer()->setPadding(0);
+            chatBox->setTextSize(100);
+            chatBox->setSize(200, 300);
+            chatBox->setLineLimit(5);
+
+            for (const bool newLinesBelowOthers : {true, false})
+            {
+                chatBox->removeAllLines();
+                chatBox->setNewLinesBelowOthers(newLinesBelowOthers);
+                for (unsigned int i = 0; i < 200000; ++i)
+                    chatBox->addLine(tgui::to_string(i % 10));
+
+                REQUIRE(chatBox->getLineAmount() == 5);
+
+                auto reference = tgui::ChatBox::copy(chatBox);
+                reference->removeAllLines();
+                for (unsigned int i = 200000 - 5; i < 200000; ++i)
+                    reference->addLine(tgui::to_string(i % 10));
+
+                for (std::size_t i = 0; i < 5; ++i)
+                    REQUIRE(chatBox->getLine(i) == reference->getLine(i));
+
+                // The lines are drawn at the same positions as in a chat box that only ever contained these lines
+                TEST_DRAW_INIT(200, 300, chatBox)
+                const sf::Image image = drawToImage(target, gui);
+                gui.remove(chatBox);
+                gui.add(reference);
+                REQUIRE(compareImageAreas(image, {0, 0}, drawToImage(target, gui), {0, 0}, {200, 300}));
+            }
+        }
+    }
+
+    SECTION("Only visible lines are drawn")
+    {
+        chatBox->getRenderer()->setBorders(0);
+        chatBox->getRenderer()->setPadding(0);
+        chatBox->setTextSize(16);
+        chatBox->setSize(200, 100);
+        for (unsigned int i = 0; i < 1000; ++i)
+            chatBox->addLine("Line " + tgui::to_string(i));
+
+        // The reference chat box is large enough to show its lines without scrolling, so none of its lines are skipped
+        const float lineHeight = tgui::Text::getLineHeight(chatBox->getSharedRenderer()->getFont(), 16);
+        const float referenceHeight = 20 * lineHeight + tgui::Text::getExtraVerticalPadding(16);
+        auto reference = tgui::ChatBox::copy(chatBox);
+        reference->removeAllLines();
+        reference->setSize(200, referenceHeight);
+        for (unsigned int i = 980; i < 1000; ++i)
+            reference->addLine("Line " + tgui::to_string(i));
+
+        TEST_DRAW_INIT(200, static_cast<unsigned int>(referenceHeight), reference)
+        const sf::Image referenceImage = drawToImage(target, gui);
+        gui.remove(reference);
+        gui.add(chatBox);
+
+        // Compares the text area of the chat box with the part of the reference that starts at the given height.
+        // The scrollbar on the right side is allowed to differ.
+        auto scrollbar = tgui::Scrollbar::create();
+        scrollbar->setRenderer(chatBox->getSharedRenderer()->getScrollbar());
+        const sf::Vector2u textAreaSize{static_cast<unsigned int>(chatBox->getSize().x - scrollbar->getSize().x),
+                                        static_cast<unsigned int>(chatBox->getSize().y)};
+        auto compareWithReference = [&](unsigned int offset){
+                return compareImageAreas(drawToImage(target, gui), {0, 0}, referenceImage, {0, offset}, textAreaSize);
+            };
+
+        // The chat box is scrolled to the bottom, with the top line only partially visible
+        const unsigned int bottomOffset = static_cast<unsigned int>(referenceHeight) - 100;
+        REQUIRE(compareWithReference(bottomOffset));
+
+        // Scroll up, so that the first and last drawn lines both lie in the middle of the lines
+        chatBox->mouseWheelScrolled(10, {10, 10});
+        REQUIRE(compareWithReference(bottomOffset - 10 * 16));
     }
 
     SECTION("Text size")
@@ -78,6 +78,19 @@ TEST_CASE("[ComboBox]")
         REQUIRE(comboBox->getItemById("1") == "Item 1");
         REQUIRE(comboBox->getItemById("2") == "Item 2");
         REQUIRE(comboBox->getItemById("3") == "");
+
+        REQUIRE(comboBox->addItems({"Item 4", "Item 5", "Item 6"}, {"4", "5"}) == 3);
+        REQUIRE(comboBox->getItemCount() == 6);
+        REQUIRE(comboBox->getItems()[3] == "Item 4");
+        REQUIRE(comboBox->getItems()[5] == "Item 6");
+        REQUIRE(comboBox->getItemById("5") == "Item 5");
+        REQUIRE(comboBox->getItemIds()[5] == "");
+
+        comboBox->setSelectedItem("Item 2");
+        REQUIRE(comboBox->setItems({"Item 7", "Item 8"}) == 2);
+        REQUIRE(comboBox->getItemCount() == 2);
+        REQUIRE(comboBox->getItems()[0] == "Item 7");
+        REQUIRE(comboBox->getSelectedItemIndex() == -1);
     }
     
     SECTION("Removing items")
@@ -110,6 +110,19 @@ TEST_CASE("[ListBox]")
         REQUIRE(listBox->getItemById("1") == "Item 1");
         REQUIRE(listBox->getItemById("2") == "Item 2");
         REQUIRE(listBox->getItemById("3") == "");
+
+        REQUIRE(listBox->addItems({"Item 4", "Item 5", "Item 6"}, {"4", "5"}) == 3);
+        REQUIRE(listBox->getItemCount() == 6);
+        REQUIRE(listBox->getItems()[3] == "Item 4");
+        REQUIRE(listBox->getItems()[5] == "Item 6");
+        REQUIRE(listBox->getItemById("5") == "Item 5");
+        REQUIRE(listBox->getItemIds()[5] == "");
+
+        listBox->setSelectedItem("Item 2");
+        REQUIRE(listBox->setItems({"Item 7", "Item 8"}) == 2);
+        REQUIRE(listBox->getItemCount() == 2);
+        REQUIRE(listBox->getItems()[0] == "Item 7");
+        REQUIRE(listBox->getSelectedItemIndex() == -1);
     }
     
     SECTION("Removing items")
@@ -246,6 +259,42 @@ TEST_CASE("[ListBox]")
         REQUIRE(!listBox->containsId("1"));
     }
 
+    SECTION("Duplicate items")
+    {
+        listBox->addItem("Item 1", "1");
+        listBox->addItem("Item 2", "2");
+        listBox->addItem("Item 1", "3");
+        listBox->addItem("Item 3", "1");
+
+        // The first item with the text or id is used
+        REQUIRE(listBox->setSelectedItem("Item 1"));
+        REQUIRE(listBox->getSelectedItemIndex() == 0);
+        REQUIRE(listBox->getItemById("1") == "Item 1");
+
+        REQUIRE(listBox->changeItemByIndex(0, "Item 0"));
+        REQUIRE(listBox->setSelectedItem("Item 1"));
+        REQUIRE(listBox->getSelectedItemIndex() == 2);
+        REQUIRE(listBox->setSelectedItem("Item 0"));
+        REQUIRE(listBox->getSelectedItemIndex() == 0);
+
+        REQUIRE(listBox->removeItemById("1"));
+        REQUIRE(listBox->getItemById("1") == "Item 3");
+        REQUIRE(listBox->setSelectedItemById("3"));
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+        REQUIRE(!listBox->contains("Item 0"));
+
+        REQUIRE(listBox->removeItemByIndex(2));
+        REQUIRE(!listBox->containsId("1"));
+        listBox->addItem("Item 4", "1");
+        REQUIRE(listBox->containsId("1"));
+        REQUIRE(listBox->getItemById("1") == "Item 4");
+
+        listBox->removeAllItems();
+        REQUIRE(!listBox->contains("Item 4"));
+        listBox->addItem("Item 4");
+        REQUIRE(listBox->contains("Item 4"));
+    }
+
     SECTION("ItemHeight")
     {
         listBox->setItemHeight(20);
@@ -269,6 +318,42 @@ TEST_CASE("[ListBox]")
         REQUIRE(listBox->getItemCount() == 3);
         REQUIRE(listBox->getItems()[0] == "Item 1");
         REQUIRE(listBox->getItems()[2] == "Item 3");
+
+        REQUIRE(listBox->addItems({"Item 7", "Item 8"}) == 0);
+        REQUIRE(listBox->setItems({"Item 7", "Item 8", "Item 9", "Item 10"}) == 3);
+        REQUIRE(listBox->getItemCount() == 3);
+        REQUIRE(listBox->getItems()[2] == "Item 9");
+    }
+
+    SECTION("Many items")
+    {
+        listBox->setSize(150, 100);
+        listBox->setItemHeight(20);
+        for (unsigned int i = 0; i < 100000; ++i)
+            listBox->addItem("Item " + tgui::to_string(i), tgui::to_string(i));
+
+        REQUIRE(listBox->getItemCount() == 100000);
+        REQUIRE(listBox->getItems()[54321] == "Item 54321");
+        REQUIRE(listBox->getItemById("99999") == "Item 99999");
+
+        TEST_DRAW_INIT(150, 100, listBox)
+
+        // Scroll through the list in both directions while drawing
+        for (std::size_t index : {std::size_t(0), std::size_t(2), std::size_t(3), std::size_t(50000), std::size_t(49998), std::size_t(99999)})
+        {
+            REQUIRE(listBox->setSelectedItemByIndex(index));
+            REQUIRE(listBox->getSelectedItem() == "Item " + tgui::to_string(index));
+            gui.draw();
+        }
+
+        REQUIRE(listBox->changeItemByIndex(99998, "Changed"));
+        REQUIRE(listBox->removeItemByIndex(0));
+        gui.draw();
+
+        REQUIRE(listBox->getItemCount() == 99999);
+        REQUIRE(listBox->getItems()[99997] == "Changed");
+        REQUIRE(listBox->getSelectedItem() == "Item 99999");
+        REQUIRE(listBox->getSelectedItemIndex() == 99998);
     }
 
     SECTION("Events / Signals")
@@ -151,6 +151,19 @@ TEST_CASE("[MenuBar]")
                 REQUIRE(menuBar->getMenus()[2].second.size() == 1);
             }
 
+            SECTION("Adding multiple menu items at once")
+            {
+                REQUIRE(!menuBar->addMenuItems("View", {"Zoom in", "Zoom out"}));
+                REQUIRE(menuBar->addMenuItems("File", {"Save as", "Quit"}));
+
+                REQUIRE(menuBar->getMenus().size() == 3);
+                REQUIRE(menuBar->getMenus()[0].second.size() == 4);
+                REQUIRE(menuBar->getMenus()[0].second[1] == "Save");
+                REQUIRE(menuBar->getMenus()[0].second[2] == "Save as");
+                REQUIRE(menuBar->getMenus()[0].second[3] == "Quit");
+                REQUIRE(menuBar->getMenus()[1].second.size() == 4);
+            }
+
             SECTION("Removing menu items")
             {
                 menuBar->removeMenuItem("Edit", "Undo");
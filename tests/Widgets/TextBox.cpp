@@ -26,6 +26,18 @@
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Clipboard.hpp>
 
+namespace
+{
+    std::string createLines(unsigned int firstLine, unsigned int lastLine)
+    {
+        std::string text;
+        for (unsigned int i = firstLine; i < lastLine; ++i)
+            text += "Line " + tgui::to_string(i) + "\n";
+
+        return text;
+    }
+}
+
 TEST_CASE("[TextBox]")
 {
     tgui::TextBox::Ptr textBox = tgui::TextBox::create();
@@ -174,6 +186,18 @@ TEST_CASE("[TextBox]")
 
         textBox->setText("More\nthan\none\nline");
         REQUIRE(textBox->getLinesCount() == 4);
+
+        // Only the edited paragraph is rearranged, the other lines have to remain correct
+        textBox->setCaretPosition(9);
+        textBox->textEntered('\n');
+        REQUIRE(textBox->getLinesCount() == 5);
+        REQUIRE(textBox->getText() == "More\nthan\n\none\nline");
+        REQUIRE(textBox->getCaretPosition() == 10);
+
+        textBox->keyPressed({sf::Keyboard::Key::BackSpace, false, false, false, false});
+        REQUIRE(textBox->getLinesCount() == 4);
+        REQUIRE(textBox->getText() == "More\nthan\none\nline");
+        REQUIRE(textBox->getCaretPosition() == 9);
     }
 
     SECTION("Events / Signals")
@@ -518,6 +542,71 @@ TEST_CASE("[TextBox]")
         }
     }
 
+    SECTION("Scrolling through long text")
+    {
+        // Only the lines around the visible area are part of the drawn texts, which should make no difference to what is
+        // shown. Each scroll position is compared with a text box that only contains the lines that should be visible.
+        textBox->setSize(200, 100);
+        textBox->setTextSize(16);
+        textBox->setText(createLines(0, 1000));
+
+        auto reference = tgui::TextBox::copy(textBox);
+
+        TEST_DRAW_INIT(static_cast<unsigned int>(textBox->getSize().x), static_cast<unsigned int>(textBox->getSize().y), textBox)
+
+        // Compares the text area of both text boxes, the scrollbars on the right side are allowed to differ
+        auto scrollbar = tgui::Scrollbar::create();
+        scrollbar->setRenderer(textBox->getSharedRenderer()->getScrollbar());
+        const sf::Vector2u textAreaSize{static_cast<unsigned int>(textBox->getSize().x - scrollbar->getSize().x),
+                                        static_cast<unsigned int>(textBox->getSize().y)};
+        auto drawSameText = [&]{
+                const sf::Image image = drawToImage(target, gui);
+                gui.remove(textBox);
+                gui.add(reference);
+                const sf::Image referenceImage = drawToImage(target, gui);
+                gui.remove(reference);
+                gui.add(textBox);
+                return compareImageAreas(image, {0, 0}, referenceImage, {0, 0}, textAreaSize);
+            };
+
+        // Select from the start of line 100 until the start of line 900, the caret ends up on line 100
+        textBox->setCaretPosition(createLines(0, 900).length());
+        for (unsigned int i = 0; i < 800; ++i)
+            textBox->keyPressed({sf::Keyboard::Key::Up, false, false, true, false});
+        REQUIRE(textBox->getSelectedText() == createLines(100, 900));
+
+        // The start of the selection lies inside the visible lines, its end lies far below them
+        textBox->mouseWheelScrolled(5, {10, 10});
+        reference->setText(createLines(95, 140));
+        reference->setCaretPosition(createLines(95, 100).length());
+        reference->keyPressed({sf::Keyboard::Key::End, false, true, true, false});
+        reference->mouseWheelScrolled(1000, {10, 10});
+        REQUIRE(drawSameText());
+
+        // Lines in the middle of the selection. The reference selection starts at the end of the line above the visible ones.
+        textBox->mouseWheelScrolled(-405, {10, 10});
+        reference->setText(createLines(499, 545));
+        reference->setCaretPosition(createLines(499, 500).length() - 1);
+        reference->keyPressed({sf::Keyboard::Key::End, false, true, true, false});
+        reference->mouseWheelScrolled(1000, {10, 10});
+        reference->mouseWheelScrolled(-1, {10, 10});
+        REQUIRE(drawSameText());
+
+        // The end of the selection lies inside the visible lines, its start lies far above them
+        textBox->mouseWheelScrolled(-397, {10, 10});
+        reference->setText(createLines(896, 940));
+        reference->setCaretPosition(createLines(896, 900).length());
+        for (unsigned int i = 0; i < 4; ++i)
+            reference->keyPressed({sf::Keyboard::Key::Up, false, false, true, false});
+        reference->keyPressed({sf::Keyboard::Key::End, false, false, true, false});
+        reference->mouseWheelScrolled(1000, {10, 10});
+        reference->mouseWheelScrolled(-1, {10, 10});
+        REQUIRE(drawSameText());
+
+        // The selected text doesn't depend on which lines are visible
+        REQUIRE(textBox->getSelectedText() == createLines(100, 900));
+    }
+
     SECTION("Bug Fixes")
     {
         SECTION("ctrl+alt+A should not act as ctrl+A (https://github.com/texus/TGUI/issues/43)")